@@ -6,6 +6,8 @@ typedef void (*CFP)();            ///> function pointer
 void vm_cfunc(int n, CFP fp);     ///< assign C interface (in slot n)
 void vm_push(int v);              ///< push value onto VM data stack
 int  vm_pop();                    ///< pop TOS off VM data stack
+int  vm_ilat(int v, int b);       ///< ISR v (11: deadline jobs) latency count in bucket b (< 32us << b), b=8: max in us
+void vm_far(void *mem, long sz);  ///< attach far memory (64K banks), i.e. external SRAM or PSRAM
 
 #if ARDUINO
 #include <Arduino.h>
@@ -7,18 +7,29 @@
 ///
 #include "eforth_core.h"
 
-void _stat(U8 *ram, int sz, StreamIO *io) {
+void _stat(U8 *ram, int sz, IU ram_sz, IU tib_sz, IU ds_sz, IU rs_sz, StreamIO *io) {
+    IU roof = FORTH_RAM_ADDR + ram_sz;        ///< same layout as vm_init
+    IU tib  = roof - tib_sz;
+    IU istk = tib  - FORTH_ISTK_SZ;
+    IU rs   = istk - rs_sz;
+    IU ds   = rs   - ds_sz;
+    IU heap = ds   - FORTH_HEAP_SZ;
     LOG_H("\r\nROM_SZ=x",  sz);
-    LOG_H(", RAM_SZ=x",  FORTH_RAM_SZ);
+    LOG_H(", RAM_SZ=x",  ram_sz);
     LOG_V(", Addr=",     (U16)sizeof(IU)*8);
     LOG_V("-bit, CELL=", CELLSZ);
     LOG("-byte\r\nMemory MAP:");
     LOG_H("\r\n  ROM  :x0000+", FORTH_ROM_SZ);
     LOG_H("\r\n  VAR  :x", FORTH_UVAR_ADDR);  LOG_H("+", FORTH_UVAR_SZ);  LOG("  <=> EEPROM");
-    LOG_H("\r\n  DIC  :x", FORTH_DIC_ADDR);   LOG_H("+", FORTH_DIC_SZ);   LOG(" <=> EEPROM");
-    LOG_H("\r\n  STACK:x", FORTH_STACK_ADDR); LOG_H("+", FORTH_STACK_SZ);
-    LOG_H("\r\n  TIB  :x", FORTH_TIB_ADDR);   LOG_H("+", FORTH_TIB_SZ);
-    LOG_H("\r\n  ROOF :x", FORTH_MAX_ADDR);
+    LOG_H("\r\n  DIC  :x", FORTH_DIC_ADDR);   LOG_H("+", heap - FORTH_DIC_ADDR); LOG(" <=> EEPROM");
+#if FORTH_HEAP_SZ
+    LOG_H("\r\n  HEAP :x", heap); LOG_H("+", FORTH_HEAP_SZ);
+#endif // FORTH_HEAP_SZ
+    LOG_H("\r\n  DSTK :x", ds);   LOG_H("+", ds_sz);
+    LOG_H("\r\n  RSTK :x", rs);   LOG_H("+", rs_sz);
+    LOG_H("\r\n  ISTK :x", istk); LOG_H("+", FORTH_ISTK_SZ);
+    LOG_H("\r\n  TIB  :x", tib);  LOG_H("+", tib_sz);
+    LOG_H("\r\n  ROOF :x", roof);
 #if ARDUINO
     extern U8 *__flp;                         ///< freelist
     U16 h = (uintptr_t)&__flp;                ///< start of heap
@@ -33,24 +44,35 @@ void _stat(U8 *ram, int sz, StreamIO *io) {
 ///
 #if ARDUINO
 #include <EEPROM.h>
+#define PROM_SZ  (FORTH_UVAR_SZ + FORTH_DIC_SZ) /**< user variables + dictionary */
 #else  // !ARDUINO
+#define PROM_SZ  FORTH_RAM_MAX                /**< host RAM is sized at startup */
 class MockPROM                                ///< mock EEPROM access class
 {
-    U8 _prom[FORTH_UVAR_SZ + FORTH_DIC_SZ];   ///< mock EEPROM storage
+    U8 _prom[PROM_SZ];                        ///< mock EEPROM storage
 public:
-    U8   read(U16 idx)         { return _prom[idx]; }
-    void update(U16 idx, U8 v) { _prom[idx] = v; }
+    U8   read(IU idx)         { return _prom[idx]; }
+    void update(IU idx, U8 v) { _prom[idx] = v; }
 };
 MockPROM EEPROM;                              ///> fake Arduino EEPROM unit
 #endif // ARDUINO
 ///
 ///> EEPROM Save/Load
 ///
+IU _cell(U8 *b)                       ///> decode a cell in VM byte order
+{
+    IU v = 0;
+    for (int i=0; i < CELLSZ; i++) {
+        v |= (IU)b[i] << (MEM_NATIVE ? 8*i : 8*(CELLSZ-1-i));
+    }
+    return v;
+}
 int ef_save(U8 *ram)
 {
     int pidx = sizeof(DU) * 2;        ///< pointer to vCP (i.e. HERE)
-    IU  here = ((IU)ram[pidx] << 8) | ram[pidx+1];
+    IU  here = _cell(&ram[pidx]);
     IU  sz   = here - FORTH_RAM_ADDR; ///< uvar + colon words
+    if (sz > PROM_SZ) return 0;       /// * dictionary larger than EEPROM
     for (IU i=0; i < sz; i++) {
         EEPROM.update(i, ram[i]);     /// * store dictionary byte-by-byte
     }
@@ -59,9 +81,11 @@ int ef_save(U8 *ram)
 int ef_load(U8 *ram)
 {
     int pidx = sizeof(DU) * 2;        ///< CP addr in EEPROM (aka HERE)
-    IU  vCP  = ((IU)EEPROM.read(pidx)<<8) | EEPROM.read(pidx+1);
+    U8  b[CELLSZ];
+    for (int i=0; i < CELLSZ; i++) b[i] = EEPROM.read(pidx+i);
+    IU  vCP  = _cell(b);
     IU  sz   = vCP - FORTH_RAM_ADDR;
-    if (!vCP || sz > FORTH_DIC_SZ) return 0; /// * prevent garbage in EEPROM
+    if (!vCP || sz > PROM_SZ) return 0;  /// * prevent garbage in EEPROM
 
     for (IU i=0; i < sz; i++) {
         ram[i] = EEPROM.read(i);      /// * retrieve dictionary byte-by-byte
@@ -80,7 +104,13 @@ extern U32    forth_rom_sz;                ///< actual size of ROM
 ///    2) uses ~700 bytes of Flash (allocator),
 ///    3) does prevent IDE complaints about low memory in compile time
 ///
+#if MEM_FLAT
+static U8     forth_mem[FORTH_MEM_SZ + CELLSZ]; ///< flat address space, ROM copied in front
+                                               ///< host sizes RAM at startup (FORTH_RAM_MAX)
+static U8     *forth_ram = &forth_mem[FORTH_RAM_ADDR];
+#else
 static U8     forth_ram[FORTH_RAM_SZ];     ///< RAM pointer (malloc)
+#endif // MEM_FLAT
 
 #if ARDUINO
 ///
@@ -88,8 +118,14 @@ static U8     forth_ram[FORTH_RAM_SZ];     ///< RAM pointer (malloc)
 ///
 void ef_setup(const char *code, StreamIO &io_stream)
 {
+#if MEM_FLAT
+    memcpy_P(forth_mem, forth_rom, forth_rom_sz);
+    vm_init((PGM_P)forth_mem, forth_ram, &io_stream, code);
+#else
     vm_init((PGM_P)forth_rom, forth_ram, &io_stream, code);
-    _stat(forth_ram, forth_rom_sz, &io_stream);
+#endif // MEM_FLAT
+    _stat(forth_ram, forth_rom_sz, FORTH_RAM_SZ, FORTH_TIB_SZ,
+          FORTH_DSTK_SZ, FORTH_RSTK_SZ, &io_stream);
 }
 ///
 ///> VM outer interpreter proxy
@@ -106,6 +142,7 @@ char *ef_ram(int i) {
 }
 
 #else  // !ARDUINO
+#include <sys/mman.h>
 #include "eForth1.h"
 
 const char code[] =
@@ -130,15 +167,40 @@ void my_add() {
     vm_push(a + b);
 }
 
+///
+///> RAM, TIB and stack sizes, e.g. EF_RAM=0x500 to mimic an UNO, EF_RS=0x100
+///
+IU _env_sz(const char *name, IU dflt, IU min, IU max) {
+    const char *v = getenv(name);
+    IU sz = v ? (IU)strtoul(v, NULL, 0) & ~(CELLSZ-1) : dflt;
+    return sz < min ? min : (sz > max ? max : sz);
+}
+
 int main(int ac, char* av[]) {
     setvbuf(stdout, NULL, _IONBF, 0);    /// * autoflush (turn STDOUT buffering off)
 
-    _stat(forth_ram, forth_rom_sz, NULL);
+    IU tib_sz = _env_sz("EF_TIB", FORTH_TIB_SZ,  0x20, 0x400);
+    IU ds_sz  = _env_sz("EF_DS",  FORTH_DSTK_SZ, 0x20, 0x1000);
+    IU rs_sz  = _env_sz("EF_RS",  FORTH_RSTK_SZ, 0x20, 0x1000);
+    IU ram_sz = _env_sz("EF_RAM", FORTH_RAM_MAX,
+                        FORTH_UVAR_SZ + 0x100 + FORTH_HEAP_SZ +
+                        ds_sz + rs_sz + FORTH_ISTK_SZ + tib_sz,
+                        FORTH_RAM_MAX);
+    _stat(forth_ram, forth_rom_sz, ram_sz, tib_sz, ds_sz, rs_sz, NULL);
     
     vm_cfunc(0, my_dot);                 ///< register C API[0]
     vm_cfunc(1, my_add);                 ///< register C API[1]
-    
-    vm_init((char*)forth_rom, forth_ram, NULL, code);
+
+    const char *fz = getenv("EF_FAR");   ///< far memory, lazily mapped (default 16M)
+    long far_sz = fz ? strtol(fz, NULL, 0) : 0x1000000;
+    void *far   = far_sz > 0
+        ? mmap(NULL, far_sz, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS|MAP_NORESERVE, -1, 0)
+        : MAP_FAILED;
+    vm_far(far == MAP_FAILED ? NULL : far, far_sz);
+
+    memcpy(forth_mem, forth_rom, forth_rom_sz);  /// * host is always flat
+    vm_init((char*)forth_mem, forth_ram, NULL, code, ram_sz, tib_sz, ds_sz, rs_sz);
+    intr_sim_start(getenv("EF_PCI"));    ///< e.g. EF_PCI="100:2,250:9"
     vm_outer();
 
     return 0;
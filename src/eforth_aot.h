@@ -0,0 +1,5989 @@
+///
+/// @file eforth_aot.h
+/// @brief eForth ROM words compiled ahead of time (generated with eforth_rom.c)
+/// @attention not a standalone header, included by eforth_vm.cpp when AOT is set
+///
+#if CELLSZ != 2
+#error "eforth_aot.h is for another CELLSZ, make rom"
+#endif // CELLSZ
+IU a_0002();
+IU a_0004();
+IU a_0006();
+IU a_0008();
+IU a_000a();
+IU a_000c();
+IU a_000e();
+IU a_0010();
+IU a_0012();
+IU a_0014();
+IU a_0016();
+IU a_0018();
+IU a_001a();
+IU a_001c();
+IU a_001e();
+IU a_0020();
+IU a_0022();
+IU a_0024();
+IU a_0026();
+IU a_0028();
+IU a_002a();
+IU a_002c();
+IU a_002e();
+IU a_0030();
+IU a_0032();
+IU a_0034();
+IU a_0036();
+IU a_0038();
+IU a_003a();
+IU a_003c();
+IU a_003e();
+IU a_0040();
+IU a_0042();
+IU a_0044();
+IU a_0046();
+IU a_0048();
+IU a_004a();
+IU a_004c();
+IU a_004e();
+IU a_0050();
+IU a_0052();
+IU a_0054();
+IU a_0056();
+IU a_0058();
+IU a_005a();
+IU a_005c();
+IU a_005e();
+IU a_0060();
+IU a_0062();
+IU a_0064();
+IU a_0066();
+IU a_0068();
+IU a_006a();
+IU a_006c();
+IU a_006e();
+IU a_0070();
+IU a_0072();
+IU a_0074();
+IU a_0076();
+IU a_0078();
+IU a_007a();
+IU a_007c();
+IU a_007e();
+IU a_0080();
+IU a_0082();
+IU a_0084();
+IU a_0086();
+IU a_0088();
+IU a_008a();
+IU a_008c();
+IU a_008e();
+IU a_0090();
+IU a_0092();
+IU a_0094();
+IU a_0096();
+IU a_0098();
+IU a_009a();
+IU a_009f();
+IU a_00a8();
+IU a_00b1();
+IU a_00b4();
+IU a_00b7();
+IU a_00bc();
+IU a_00c3();
+IU a_00c6();
+IU a_00c9();
+IU a_00cc();
+IU a_00d0();
+IU a_00d4();
+IU a_00d8();
+IU a_00dc();
+IU a_00de();
+IU a_00e0();
+IU a_00e2();
+IU a_00e4();
+IU a_00e6();
+IU a_00e8();
+IU a_00ea();
+IU a_00ec();
+IU a_00ee();
+IU a_00f2();
+IU a_00f6();
+IU a_00fa();
+IU a_00fe();
+IU a_0102();
+IU a_0106();
+IU a_010a();
+IU a_010e();
+IU a_0112();
+IU a_0116();
+IU a_011a();
+IU a_011e();
+IU a_0122();
+IU a_0126();
+IU a_012a();
+IU a_012e();
+IU a_0132();
+IU a_0136();
+IU a_013a();
+IU a_013e();
+IU a_0142();
+IU a_0146();
+IU a_014a();
+IU a_014e();
+IU a_0153();
+IU a_0162();
+IU a_0166();
+IU a_016e();
+IU a_0172();
+IU a_0184();
+IU a_019a();
+IU a_01aa();
+IU a_01b6();
+IU a_01c0();
+IU a_01c6();
+IU a_01cf();
+IU a_01d8();
+IU a_01e0();
+IU a_01ee();
+IU a_01f8();
+IU a_0207();
+IU a_020b();
+IU a_0211();
+IU a_0217();
+IU a_022f();
+IU a_0288();
+IU a_028b();
+IU a_029a();
+IU a_029e();
+IU a_02ab();
+IU a_02b2();
+IU a_02bc();
+IU a_02bf();
+IU a_02c4();
+IU a_02cf();
+IU a_02df();
+IU a_02e4();
+IU a_02eb();
+IU a_02ef();
+IU a_0343();
+IU a_034e();
+IU a_0363();
+IU a_0370();
+IU a_0379();
+IU a_038a();
+IU a_03b2();
+IU a_0409();
+IU a_0434();
+IU a_0447();
+IU a_044d();
+IU a_0468();
+IU a_048a();
+IU a_0491();
+IU a_04a2();
+IU a_04ab();
+IU a_04ad();
+IU a_04b9();
+IU a_04e6();
+IU a_04ed();
+IU a_050e();
+IU a_0525();
+IU a_0534();
+IU a_053e();
+IU a_0547();
+IU a_054b();
+IU a_055c();
+IU a_055e();
+IU a_0566();
+IU a_0568();
+IU a_05ae();
+IU a_05c8();
+IU a_05ec();
+IU a_0610();
+IU a_061a();
+IU a_062a();
+IU a_062f();
+IU a_0636();
+IU a_0644();
+IU a_0649();
+IU a_064f();
+IU a_0657();
+IU a_066b();
+IU a_0693();
+IU a_06a2();
+IU a_06f5();
+IU a_072b();
+IU a_0765();
+IU a_076c();
+IU a_0772();
+IU a_0774();
+IU a_0776();
+IU a_0778();
+IU a_0781();
+IU a_0891();
+IU a_08ac();
+IU a_08b6();
+IU a_08bc();
+IU a_08c4();
+IU a_08ca();
+IU a_08d4();
+IU a_08e2();
+IU a_08e8();
+IU a_08ec();
+IU a_08f0();
+IU a_08f5();
+IU a_08fb();
+IU a_0902();
+IU a_0908();
+IU a_0914();
+IU a_091c();
+IU a_0924();
+IU a_092e();
+IU a_0937();
+IU a_0940();
+IU a_094c();
+IU a_0955();
+IU a_0971();
+IU a_0978();
+IU a_098e();
+IU a_0998();
+IU a_09b0();
+IU a_09c9();
+IU a_09dd();
+IU a_09e6();
+IU a_09ef();
+IU a_09fe();
+IU a_0a06();
+IU a_0a17();
+IU a_0a1a();
+IU a_0a2a();
+IU a_0a5e();
+IU a_0a7a();
+IU a_0a80();
+IU a_0a88();
+IU a_0a90();
+IU a_0a96();
+IU a_0a9d();
+IU a_0aaf();
+IU a_0ab6();
+IU a_0abc();
+IU a_0ac3();
+IU a_0ace();
+IU a_0ad9();
+IU a_0ae0();
+IU a_0ae2();
+IU a_0ae4();
+IU a_0ae6();
+IU a_0ae8();
+IU a_0aea();
+IU a_0aec();
+IU a_0aee();
+IU a_0af0();
+IU a_0af2();
+IU a_0af4();
+IU a_0af6();
+IU a_0af8();
+IU a_0afa();
+IU a_0afc();
+IU a_0afe();
+IU a_0b00();
+IU a_0b02();
+IU a_0b04();
+IU a_0b06();
+IU a_0b08();
+IU a_0b0a();
+IU a_0b0c();
+IU a_0b0e();
+IU a_0b10();
+IU a_0b12();
+IU a_0b14();
+IU a_0b16();
+IU a_0b18();
+IU a_0b1a();
+IU a_0b1c();
+IU a_0b1e();
+IU a_0b20();
+IU a_0b34();
+IU a_0b46();
+IU a_0b4a();
+IU a_0b51();
+IU a_0b59();
+
+IU a_0002() {    /// : NOP ;
+       
+       A_EXIT(0x3);
+    return 0x4;
+}
+
+IU a_0004() {    /// : EXIT ;
+       A_EXIT(0x4);
+       A_EXIT(0x5);
+    return 0x6;
+}
+
+IU a_0006() {    /// : ENTER ;
+       
+       A_EXIT(0x7);
+    return 0x8;
+}
+
+IU a_0008() {    /// : BYE ;
+       return 0x8;
+       A_EXIT(0x9);
+    return 0xa;
+}
+
+IU a_000a() {    /// : ?KEY ;
+       p_QRX();
+       A_EXIT(0xb);
+    return 0xc;
+}
+
+IU a_000c() {    /// : EMIT ;
+       p_TXSTO();
+       A_EXIT(0xd);
+    return 0xe;
+}
+
+IU a_000e() {    /// : BYTE ;
+       PUSH(0x1);
+    return 0x10;
+}
+
+IU a_0010() {    /// : DOLIT ;
+       PUSH((DU)0x108);
+    return 0x12;
+}
+
+IU a_0012() {    /// : DOVAR ;
+       PUSH(0x14);
+       A_EXIT(0x13);
+    return 0x14;
+}
+
+IU a_0014() {    /// : QBRANCH ;
+       if (!T) { POP(); return 0x10d; } POP();
+    return 0x16;
+}
+
+IU a_0016() {    /// : BRANCH ;
+       return 0x10b;
+    return 0x18;
+}
+
+IU a_0018() {    /// : DONEXT ;
+       if (I-- > 0) { return 0x176; } RPOP();
+    return 0x1a;
+}
+
+IU a_001a() {    /// : (DO) ;
+       return 0x1a;
+    return 0x1c;
+}
+
+IU a_001c() {    /// : (LOOP) ;
+       return 0x1c;
+    return 0x1e;
+}
+
+IU a_001e() {    /// : (+LOOP) ;
+       return 0x1e;
+    return 0x20;
+}
+
+IU a_0020() {    /// : EXECUTE ;
+    IU ip;
+L0020: A_EXEC(0x20);
+L0021: A_EXIT(0x21);
+    return 0x22;
+resume:
+    switch (ip) {
+    case 0x20: goto L0020;
+    case 0x21: goto L0021;
+    }
+    return ip;
+}
+
+IU a_0022() {    /// : ! ;
+       p_STORE();
+       A_EXIT(0x23);
+    return 0x24;
+}
+
+IU a_0024() {    /// : +! ;
+       p_PSTOR();
+       A_EXIT(0x25);
+    return 0x26;
+}
+
+IU a_0026() {    /// : @ ;
+       p_AT();
+       A_EXIT(0x27);
+    return 0x28;
+}
+
+IU a_0028() {    /// : C! ;
+       p_CSTOR();
+       A_EXIT(0x29);
+    return 0x2a;
+}
+
+IU a_002a() {    /// : C@ ;
+       p_CAT();
+       A_EXIT(0x2b);
+    return 0x2c;
+}
+
+IU a_002c() {    /// : R> ;
+       p_RFROM();
+       A_EXIT(0x2d);
+    return 0x2e;
+}
+
+IU a_002e() {    /// : R@ ;
+       p_RAT();
+       A_EXIT(0x2f);
+    return 0x30;
+}
+
+IU a_0030() {    /// : >R ;
+       p_TOR();
+       A_EXIT(0x31);
+    return 0x32;
+}
+
+IU a_0032() {    /// : DROP ;
+       p_DROP();
+       A_EXIT(0x33);
+    return 0x34;
+}
+
+IU a_0034() {    /// : DUP ;
+       p_DUP();
+       A_EXIT(0x35);
+    return 0x36;
+}
+
+IU a_0036() {    /// : SWAP ;
+       p_SWAP();
+       A_EXIT(0x37);
+    return 0x38;
+}
+
+IU a_0038() {    /// : OVER ;
+       p_OVER();
+       A_EXIT(0x39);
+    return 0x3a;
+}
+
+IU a_003a() {    /// : ROT ;
+       p_ROT();
+       A_EXIT(0x3b);
+    return 0x3c;
+}
+
+IU a_003c() {    /// : PICK ;
+       p_PICK();
+       A_EXIT(0x3d);
+    return 0x3e;
+}
+
+IU a_003e() {    /// : AND ;
+       p_AND();
+       A_EXIT(0x3f);
+    return 0x40;
+}
+
+IU a_0040() {    /// : OR ;
+       p_OR();
+       A_EXIT(0x41);
+    return 0x42;
+}
+
+IU a_0042() {    /// : XOR ;
+       p_XOR();
+       A_EXIT(0x43);
+    return 0x44;
+}
+
+IU a_0044() {    /// : INVERT ;
+       p_INV();
+       A_EXIT(0x45);
+    return 0x46;
+}
+
+IU a_0046() {    /// : LSHIFT ;
+       p_LSH();
+       A_EXIT(0x47);
+    return 0x48;
+}
+
+IU a_0048() {    /// : RSHIFT ;
+       p_RSH();
+       A_EXIT(0x49);
+    return 0x4a;
+}
+
+IU a_004a() {    /// : + ;
+       p_ADD();
+       A_EXIT(0x4b);
+    return 0x4c;
+}
+
+IU a_004c() {    /// : - ;
+       p_SUB();
+       A_EXIT(0x4d);
+    return 0x4e;
+}
+
+IU a_004e() {    /// : * ;
+       p_MUL();
+       A_EXIT(0x4f);
+    return 0x50;
+}
+
+IU a_0050() {    /// : / ;
+       p_DIV();
+       A_EXIT(0x51);
+    return 0x52;
+}
+
+IU a_0052() {    /// : MOD ;
+       p_MOD();
+       A_EXIT(0x53);
+    return 0x54;
+}
+
+IU a_0054() {    /// : NEGATE ;
+       p_NEG();
+       A_EXIT(0x55);
+    return 0x56;
+}
+
+IU a_0056() {    /// : > ;
+       p_GT();
+       A_EXIT(0x57);
+    return 0x58;
+}
+
+IU a_0058() {    /// : = ;
+       p_EQ();
+       A_EXIT(0x59);
+    return 0x5a;
+}
+
+IU a_005a() {    /// : < ;
+       p_LT();
+       A_EXIT(0x5b);
+    return 0x5c;
+}
+
+IU a_005c() {    /// : 0> ;
+       p_ZGT();
+       A_EXIT(0x5d);
+    return 0x5e;
+}
+
+IU a_005e() {    /// : 0= ;
+       p_ZEQ();
+       A_EXIT(0x5f);
+    return 0x60;
+}
+
+IU a_0060() {    /// : 0< ;
+       p_ZLT();
+       A_EXIT(0x61);
+    return 0x62;
+}
+
+IU a_0062() {    /// : 1+ ;
+       p_ONEP();
+       A_EXIT(0x63);
+    return 0x64;
+}
+
+IU a_0064() {    /// : 1- ;
+       p_ONEM();
+       A_EXIT(0x65);
+    return 0x66;
+}
+
+IU a_0066() {    /// : ?DUP ;
+       p_QDUP();
+       A_EXIT(0x67);
+    return 0x68;
+}
+
+IU a_0068() {    /// : DEPTH ;
+       p_DEPTH();
+       A_EXIT(0x69);
+    return 0x6a;
+}
+
+IU a_006a() {    /// : RP ;
+       p_RP();
+       A_EXIT(0x6b);
+    return 0x6c;
+}
+
+IU a_006c() {    /// : BL ;
+       p_BL();
+       A_EXIT(0x6d);
+    return 0x6e;
+}
+
+IU a_006e() {    /// : CELL ;
+       p_CELL();
+       A_EXIT(0x6f);
+    return 0x70;
+}
+
+IU a_0070() {    /// : ABS ;
+       p_ABS();
+       A_EXIT(0x71);
+    return 0x72;
+}
+
+IU a_0072() {    /// : MAX ;
+       p_MAX();
+       A_EXIT(0x73);
+    return 0x74;
+}
+
+IU a_0074() {    /// : MIN ;
+       p_MIN();
+       A_EXIT(0x75);
+    return 0x76;
+}
+
+IU a_0076() {    /// : WITHIN ;
+       p_WITHIN();
+       A_EXIT(0x77);
+    return 0x78;
+}
+
+IU a_0078() {    /// : >UPPER ;
+       p_TOUPP();
+       A_EXIT(0x79);
+    return 0x7a;
+}
+
+IU a_007a() {    /// : COUNT ;
+       p_COUNT();
+       A_EXIT(0x7b);
+    return 0x7c;
+}
+
+IU a_007c() {    /// : U< ;
+       p_ULESS();
+       A_EXIT(0x7d);
+    return 0x7e;
+}
+
+IU a_007e() {    /// : UM/MOD ;
+       p_UMMOD();
+       A_EXIT(0x7f);
+    return 0x80;
+}
+
+IU a_0080() {    /// : UM* ;
+       p_UMSTAR();
+       A_EXIT(0x81);
+    return 0x82;
+}
+
+IU a_0082() {    /// : M* ;
+       p_MSTAR();
+       A_EXIT(0x83);
+    return 0x84;
+}
+
+IU a_0084() {    /// : UM+ ;
+       p_UMPLUS();
+       A_EXIT(0x85);
+    return 0x86;
+}
+
+IU a_0086() {    /// : */MOD ;
+       p_SSMOD();
+       A_EXIT(0x87);
+    return 0x88;
+}
+
+IU a_0088() {    /// : /MOD ;
+       p_SMOD();
+       A_EXIT(0x89);
+    return 0x8a;
+}
+
+IU a_008a() {    /// : */ ;
+       p_MSLAS();
+       A_EXIT(0x8b);
+    return 0x8c;
+}
+
+IU a_008c() {    /// : S>D ;
+       p_S2D();
+       A_EXIT(0x8d);
+    return 0x8e;
+}
+
+IU a_008e() {    /// : D>S ;
+       p_D2S();
+       A_EXIT(0x8f);
+    return 0x90;
+}
+
+IU a_0090() {    /// : DABS ;
+       p_DABS();
+       A_EXIT(0x91);
+    return 0x92;
+}
+
+IU a_0092() {    /// : DNEGATE ;
+       p_DNEG();
+       A_EXIT(0x93);
+    return 0x94;
+}
+
+IU a_0094() {    /// : D+ ;
+       p_DADD();
+       A_EXIT(0x95);
+    return 0x96;
+}
+
+IU a_0096() {    /// : D- ;
+       p_DSUB();
+       A_EXIT(0x97);
+    return 0x98;
+}
+
+IU a_0098() {    /// : UD/MOD ;
+       p_UDSMOD();
+       A_EXIT(0x99);
+    return 0x9a;
+}
+
+IU a_009a() {    /// : D0= ;
+       p_ZEQ();
+       p_SWAP();
+       p_ZEQ();
+       p_AND();
+       A_EXIT(0x9e);
+    return 0x9f;
+}
+
+IU a_009f() {    /// : 2! ;
+       p_DUP();
+       p_TOR();
+       PUSH(0x2);
+       p_ADD();
+       p_STORE();
+       p_RFROM();
+       p_STORE();
+       A_EXIT(0xa7);
+    return 0xa8;
+}
+
+IU a_00a8() {    /// : 2@ ;
+       p_DUP();
+       p_TOR();
+       p_AT();
+       p_RFROM();
+       PUSH(0x2);
+       p_ADD();
+       p_AT();
+       A_EXIT(0xb0);
+    return 0xb1;
+}
+
+IU a_00b1() {    /// : 2DUP ;
+       p_OVER();
+       p_OVER();
+       A_EXIT(0xb3);
+    return 0xb4;
+}
+
+IU a_00b4() {    /// : 2DROP ;
+       p_DROP();
+       p_DROP();
+       A_EXIT(0xb6);
+    return 0xb7;
+}
+
+IU a_00b7() {    /// : 2SWAP ;
+       p_ROT();
+       p_TOR();
+       p_ROT();
+       p_RFROM();
+       A_EXIT(0xbb);
+    return 0xbc;
+}
+
+IU a_00bc() {    /// : 2OVER ;
+       PUSH(0x3);
+       p_PICK();
+       PUSH(0x3);
+       p_PICK();
+       A_EXIT(0xc2);
+    return 0xc3;
+}
+
+IU a_00c3() {    /// : CELL+ ;
+       p_CELL();
+       p_ADD();
+       A_EXIT(0xc5);
+    return 0xc6;
+}
+
+IU a_00c6() {    /// : CELL- ;
+       p_CELL();
+       p_SUB();
+       A_EXIT(0xc8);
+    return 0xc9;
+}
+
+IU a_00c9() {    /// : CELLS ;
+       p_CELL();
+       p_MUL();
+       A_EXIT(0xcb);
+    return 0xcc;
+}
+
+IU a_00cc() {    /// : 2+ ;
+       PUSH(0x2);
+       p_ADD();
+       A_EXIT(0xcf);
+    return 0xd0;
+}
+
+IU a_00d0() {    /// : 2- ;
+       PUSH(0x2);
+       p_SUB();
+       A_EXIT(0xd3);
+    return 0xd4;
+}
+
+IU a_00d4() {    /// : 2* ;
+       PUSH(0x1);
+       p_LSH();
+       A_EXIT(0xd7);
+    return 0xd8;
+}
+
+IU a_00d8() {    /// : 2/ ;
+       PUSH(0x1);
+       p_RSH();
+       A_EXIT(0xdb);
+    return 0xdc;
+}
+
+IU a_00dc() {    /// : SP@ ;
+       p_SPAT();
+       A_EXIT(0xdd);
+    return 0xde;
+}
+
+IU a_00de() {    /// : I ;
+       p_RAT();
+       A_EXIT(0xdf);
+    return 0xe0;
+}
+
+IU a_00e0() {    /// : J ;
+       p_J();
+       A_EXIT(0xe1);
+    return 0xe2;
+}
+
+IU a_00e2() {    /// : UNLOOP ;
+       p_UNLOOP();
+       A_EXIT(0xe3);
+    return 0xe4;
+}
+
+IU a_00e4() {    /// : LEAVE ;
+       return 0xe4;
+       A_EXIT(0xe5);
+    return 0xe6;
+}
+
+IU a_00e6() {    /// : TRACE ;
+       p_TRC();
+       A_EXIT(0xe7);
+    return 0xe8;
+}
+
+IU a_00e8() {    /// : SAVE ;
+       p_SAVE();
+       A_EXIT(0xe9);
+    return 0xea;
+}
+
+IU a_00ea() {    /// : LOAD ;
+       p_LOAD();
+       A_EXIT(0xeb);
+    return 0xec;
+}
+
+IU a_00ec() {    /// : CALL ;
+       p_CALL();
+       A_EXIT(0xed);
+    return 0xee;
+}
+
+IU a_00ee() {    /// : 'TIB ;
+       PUSH((DU)0x2000);
+       A_EXIT(0xf1);
+    return 0xf2;
+}
+
+IU a_00f2() {    /// : BASE ;
+       PUSH((DU)0x2002);
+       A_EXIT(0xf5);
+    return 0xf6;
+}
+
+IU a_00f6() {    /// : CP ;
+       PUSH((DU)0x2004);
+       A_EXIT(0xf9);
+    return 0xfa;
+}
+
+IU a_00fa() {    /// : CONTEXT ;
+       PUSH((DU)0x2006);
+       A_EXIT(0xfd);
+    return 0xfe;
+}
+
+IU a_00fe() {    /// : LAST ;
+       PUSH((DU)0x2008);
+       A_EXIT(0x101);
+    return 0x102;
+}
+
+IU a_0102() {    /// : 'MODE ;
+       PUSH((DU)0x200a);
+       A_EXIT(0x105);
+    return 0x106;
+}
+
+IU a_0106() {    /// : 'ABORT ;
+       PUSH((DU)0x200c);
+       A_EXIT(0x109);
+    return 0x10a;
+}
+
+IU a_010a() {    /// : HLD ;
+       PUSH((DU)0x200e);
+       A_EXIT(0x10d);
+    return 0x10e;
+}
+
+IU a_010e() {    /// : SPAN ;
+       PUSH((DU)0x2010);
+       A_EXIT(0x111);
+    return 0x112;
+}
+
+IU a_0112() {    /// : >IN ;
+       PUSH((DU)0x2012);
+       A_EXIT(0x115);
+    return 0x116;
+}
+
+IU a_0116() {    /// : #TIB ;
+       PUSH((DU)0x2014);
+       A_EXIT(0x119);
+    return 0x11a;
+}
+
+IU a_011a() {    /// : tmp ;
+       PUSH((DU)0x2016);
+       A_EXIT(0x11d);
+    return 0x11e;
+}
+
+IU a_011e() {    /// : SP0 ;
+       PUSH((DU)0x2018);
+       A_EXIT(0x121);
+    return 0x122;
+}
+
+IU a_0122() {    /// : TIB0 ;
+       PUSH((DU)0x201a);
+       A_EXIT(0x125);
+    return 0x126;
+}
+
+IU a_0126() {    /// : /TIB ;
+       PUSH((DU)0x201c);
+       A_EXIT(0x129);
+    return 0x12a;
+}
+
+IU a_012a() {    /// : NP ;
+       PUSH((DU)0x201e);
+       A_EXIT(0x12d);
+    return 0x12e;
+}
+
+IU a_012e() {    /// : 'HDR ;
+       PUSH((DU)0x2020);
+       A_EXIT(0x131);
+    return 0x132;
+}
+
+IU a_0132() {    /// : 'BOOT ;
+       PUSH((DU)0x2022);
+       A_EXIT(0x135);
+    return 0x136;
+}
+
+IU a_0136() {    /// : CURRENT ;
+       PUSH((DU)0x2024);
+       A_EXIT(0x139);
+    return 0x13a;
+}
+
+IU a_013a() {    /// : VOC-LINK ;
+       PUSH((DU)0x2026);
+       A_EXIT(0x13d);
+    return 0x13e;
+}
+
+IU a_013e() {    /// : 'ORDER ;
+       PUSH((DU)0x2028);
+       A_EXIT(0x141);
+    return 0x142;
+}
+
+IU a_0142() {    /// : 'TAIL ;
+       PUSH((DU)0x2038);
+       A_EXIT(0x145);
+    return 0x146;
+}
+
+IU a_0146() {    /// : 'LIT ;
+       PUSH((DU)0x203a);
+       A_EXIT(0x149);
+    return 0x14a;
+}
+
+IU a_014a() {    /// : S0 ;
+    IU ip;
+L014a: A_CALL(0x14a, a_011e);
+L014c: p_AT();
+L014d: A_EXIT(0x14d);
+    return 0x14e;
+resume:
+    switch (ip) {
+    case 0x14a: goto L014a;
+    case 0x14c: goto L014c;
+    case 0x14d: goto L014d;
+    }
+    return ip;
+}
+
+IU a_014e() {    /// : KEY ;
+L014e: p_QRX();
+       if (!T) { POP(); A_LOOP(0x14e, L014e); } POP();
+       A_EXIT(0x152);
+    return 0x153;
+}
+
+IU a_0153() {    /// : >CHAR ;
+       PUSH(0x7f);
+       p_AND();
+       p_DUP();
+       PUSH(0x7f);
+       p_BL();
+       p_WITHIN();
+       if (!T) { POP(); goto L0161; } POP();
+       p_DROP();
+       PUSH(0x5f);
+L0161: A_EXIT(0x161);
+    return 0x162;
+}
+
+IU a_0162() {    /// : HERE ;
+    IU ip;
+L0162: A_CALL(0x162, a_00f6);
+L0164: p_AT();
+L0165: A_EXIT(0x165);
+    return 0x166;
+resume:
+    switch (ip) {
+    case 0x162: goto L0162;
+    case 0x164: goto L0164;
+    case 0x165: goto L0165;
+    }
+    return ip;
+}
+
+IU a_0166() {    /// : PAD ;
+    IU ip;
+L0166: A_CALL(0x166, a_0122);
+L0168: p_AT();
+L0169: A_CALL(0x169, a_0126);
+L016b: p_AT();
+L016c: p_ADD();
+L016d: A_EXIT(0x16d);
+    return 0x16e;
+resume:
+    switch (ip) {
+    case 0x166: goto L0166;
+    case 0x168: goto L0168;
+    case 0x169: goto L0169;
+    case 0x16b: goto L016b;
+    case 0x16c: goto L016c;
+    case 0x16d: goto L016d;
+    }
+    return ip;
+}
+
+IU a_016e() {    /// : TIB ;
+    IU ip;
+L016e: A_CALL(0x16e, a_00ee);
+L0170: p_AT();
+L0171: A_EXIT(0x171);
+    return 0x172;
+resume:
+    switch (ip) {
+    case 0x16e: goto L016e;
+    case 0x170: goto L0170;
+    case 0x171: goto L0171;
+    }
+    return ip;
+}
+
+IU a_0172() {    /// : CMOVE ;
+       p_TOR();
+       goto L017e;
+L0176: p_OVER();
+       p_CAT();
+       p_OVER();
+       p_CSTOR();
+       p_TOR();
+       p_ONEP();
+       p_RFROM();
+       p_ONEP();
+L017e: if (I-- > 0) { A_LOOP(0x176, L0176); } RPOP();
+       p_DROP();
+       p_DROP();
+       A_EXIT(0x183);
+    return 0x184;
+}
+
+IU a_0184() {    /// : MOVE ;
+       p_CELL();
+       p_DIV();
+       p_TOR();
+       goto L0194;
+L018a: p_OVER();
+       p_AT();
+       p_OVER();
+       p_STORE();
+       p_TOR();
+       p_CELL();
+       p_ADD();
+       p_RFROM();
+       p_CELL();
+       p_ADD();
+L0194: if (I-- > 0) { A_LOOP(0x18a, L018a); } RPOP();
+       p_DROP();
+       p_DROP();
+       A_EXIT(0x199);
+    return 0x19a;
+}
+
+IU a_019a() {    /// : FILL ;
+    IU ip;
+L019a: p_SWAP();
+L019b: p_TOR();
+L019c: p_SWAP();
+L019d: goto L01a4;
+L01a0: A_CALL(0x1a0, a_00b1);
+L01a2: p_CSTOR();
+L01a3: p_ONEP();
+L01a4: if (I-- > 0) { A_LOOP(0x1a0, L01a0); } RPOP();
+L01a7: p_DROP();
+L01a8: p_DROP();
+L01a9: A_EXIT(0x1a9);
+    return 0x1aa;
+resume:
+    switch (ip) {
+    case 0x19a: goto L019a;
+    case 0x19b: goto L019b;
+    case 0x19c: goto L019c;
+    case 0x19d: goto L019d;
+    case 0x1a0: goto L01a0;
+    case 0x1a2: goto L01a2;
+    case 0x1a3: goto L01a3;
+    case 0x1a4: goto L01a4;
+    case 0x1a7: goto L01a7;
+    case 0x1a8: goto L01a8;
+    case 0x1a9: goto L01a9;
+    }
+    return ip;
+}
+
+IU a_01aa() {    /// : DIGIT ;
+       PUSH(0x9);
+       p_OVER();
+       p_LT();
+       PUSH(0x7);
+       p_AND();
+       p_ADD();
+       PUSH(0x30);
+       p_ADD();
+       A_EXIT(0x1b5);
+    return 0x1b6;
+}
+
+IU a_01b6() {    /// : HOLD ;
+    IU ip;
+L01b6: A_CALL(0x1b6, a_010a);
+L01b8: p_AT();
+L01b9: p_ONEM();
+L01ba: p_DUP();
+L01bb: A_CALL(0x1bb, a_010a);
+L01bd: p_STORE();
+L01be: p_CSTOR();
+L01bf: A_EXIT(0x1bf);
+    return 0x1c0;
+resume:
+    switch (ip) {
+    case 0x1b6: goto L01b6;
+    case 0x1b8: goto L01b8;
+    case 0x1b9: goto L01b9;
+    case 0x1ba: goto L01ba;
+    case 0x1bb: goto L01bb;
+    case 0x1bd: goto L01bd;
+    case 0x1be: goto L01be;
+    case 0x1bf: goto L01bf;
+    }
+    return ip;
+}
+
+IU a_01c0() {    /// : <# ;
+    IU ip;
+L01c0: A_CALL(0x1c0, a_0166);
+L01c2: A_CALL(0x1c2, a_010a);
+L01c4: p_STORE();
+L01c5: A_EXIT(0x1c5);
+    return 0x1c6;
+resume:
+    switch (ip) {
+    case 0x1c0: goto L01c0;
+    case 0x1c2: goto L01c2;
+    case 0x1c4: goto L01c4;
+    case 0x1c5: goto L01c5;
+    }
+    return ip;
+}
+
+IU a_01c6() {    /// : SIGN ;
+    IU ip;
+L01c6: p_ZLT();
+L01c7: if (!T) { POP(); goto L01ce; } POP();
+L01ca: PUSH(0x2d);
+L01cc: A_CALL(0x1cc, a_01b6);
+L01ce: A_EXIT(0x1ce);
+    return 0x1cf;
+resume:
+    switch (ip) {
+    case 0x1c6: goto L01c6;
+    case 0x1c7: goto L01c7;
+    case 0x1ca: goto L01ca;
+    case 0x1cc: goto L01cc;
+    case 0x1ce: goto L01ce;
+    }
+    return ip;
+}
+
+IU a_01cf() {    /// : EXTRACT ;
+    IU ip;
+L01cf: PUSH(0x0);
+L01d1: p_UDSMOD();
+L01d2: A_CALL(0x1d2, a_00b7);
+L01d4: p_DROP();
+L01d5: A_CALL(0x1d5, a_01aa);
+L01d7: A_EXIT(0x1d7);
+    return 0x1d8;
+resume:
+    switch (ip) {
+    case 0x1cf: goto L01cf;
+    case 0x1d1: goto L01d1;
+    case 0x1d2: goto L01d2;
+    case 0x1d4: goto L01d4;
+    case 0x1d5: goto L01d5;
+    case 0x1d7: goto L01d7;
+    }
+    return ip;
+}
+
+IU a_01d8() {    /// : # ;
+    IU ip;
+L01d8: A_CALL(0x1d8, a_00f2);
+L01da: p_AT();
+L01db: A_CALL(0x1db, a_01cf);
+L01dd: A_CALL(0x1dd, a_01b6);
+L01df: A_EXIT(0x1df);
+    return 0x1e0;
+resume:
+    switch (ip) {
+    case 0x1d8: goto L01d8;
+    case 0x1da: goto L01da;
+    case 0x1db: goto L01db;
+    case 0x1dd: goto L01dd;
+    case 0x1df: goto L01df;
+    }
+    return ip;
+}
+
+IU a_01e0() {    /// : #S ;
+    IU ip;
+L01e0: A_CALL(0x1e0, a_01d8);
+L01e2: A_CALL(0x1e2, a_00b1);
+L01e4: A_CALL(0x1e4, a_009a);
+L01e6: p_INV();
+L01e7: if (!T) { POP(); goto L01ed; } POP();
+L01ea: A_LOOP(0x1e0, L01e0);
+L01ed: A_EXIT(0x1ed);
+    return 0x1ee;
+resume:
+    switch (ip) {
+    case 0x1e0: goto L01e0;
+    case 0x1e2: goto L01e2;
+    case 0x1e4: goto L01e4;
+    case 0x1e6: goto L01e6;
+    case 0x1e7: goto L01e7;
+    case 0x1ea: goto L01ea;
+    case 0x1ed: goto L01ed;
+    }
+    return ip;
+}
+
+IU a_01ee() {    /// : #> ;
+    IU ip;
+L01ee: A_CALL(0x1ee, a_00b4);
+L01f0: A_CALL(0x1f0, a_010a);
+L01f2: p_AT();
+L01f3: A_CALL(0x1f3, a_0166);
+L01f5: p_OVER();
+L01f6: p_SUB();
+L01f7: A_EXIT(0x1f7);
+    return 0x1f8;
+resume:
+    switch (ip) {
+    case 0x1ee: goto L01ee;
+    case 0x1f0: goto L01f0;
+    case 0x1f2: goto L01f2;
+    case 0x1f3: goto L01f3;
+    case 0x1f5: goto L01f5;
+    case 0x1f6: goto L01f6;
+    case 0x1f7: goto L01f7;
+    }
+    return ip;
+}
+
+IU a_01f8() {    /// : DSTR ;
+    IU ip;
+L01f8: A_CALL(0x1f8, a_00b1);
+L01fa: p_TOR();
+L01fb: p_DROP();
+L01fc: p_DABS();
+L01fd: A_CALL(0x1fd, a_01c0);
+L01ff: A_CALL(0x1ff, a_01e0);
+L0201: p_RFROM();
+L0202: A_CALL(0x202, a_01c6);
+L0204: A_CALL(0x204, a_01ee);
+L0206: A_EXIT(0x206);
+    return 0x207;
+resume:
+    switch (ip) {
+    case 0x1f8: goto L01f8;
+    case 0x1fa: goto L01fa;
+    case 0x1fb: goto L01fb;
+    case 0x1fc: goto L01fc;
+    case 0x1fd: goto L01fd;
+    case 0x1ff: goto L01ff;
+    case 0x201: goto L0201;
+    case 0x202: goto L0202;
+    case 0x204: goto L0204;
+    case 0x206: goto L0206;
+    }
+    return ip;
+}
+
+IU a_0207() {    /// : STR ;
+    IU ip;
+L0207: p_S2D();
+L0208: A_CALL(0x208, a_01f8);
+L020a: A_EXIT(0x20a);
+    return 0x20b;
+resume:
+    switch (ip) {
+    case 0x207: goto L0207;
+    case 0x208: goto L0208;
+    case 0x20a: goto L020a;
+    }
+    return ip;
+}
+
+IU a_020b() {    /// : HEX ;
+    IU ip;
+L020b: PUSH(0x10);
+L020d: A_CALL(0x20d, a_00f2);
+L020f: p_STORE();
+L0210: A_EXIT(0x210);
+    return 0x211;
+resume:
+    switch (ip) {
+    case 0x20b: goto L020b;
+    case 0x20d: goto L020d;
+    case 0x20f: goto L020f;
+    case 0x210: goto L0210;
+    }
+    return ip;
+}
+
+IU a_0211() {    /// : DECIMAL ;
+    IU ip;
+L0211: PUSH(0xa);
+L0213: A_CALL(0x213, a_00f2);
+L0215: p_STORE();
+L0216: A_EXIT(0x216);
+    return 0x217;
+resume:
+    switch (ip) {
+    case 0x211: goto L0211;
+    case 0x213: goto L0213;
+    case 0x215: goto L0215;
+    case 0x216: goto L0216;
+    }
+    return ip;
+}
+
+IU a_0217() {    /// : DIGIT? ;
+       p_TOR();
+       p_TOUPP();
+       PUSH(0x30);
+       p_SUB();
+       PUSH(0x9);
+       p_OVER();
+       p_LT();
+       if (!T) { POP(); goto L022b; } POP();
+       PUSH(0x7);
+       p_SUB();
+       p_DUP();
+       PUSH(0xa);
+       p_LT();
+       p_OR();
+L022b: p_DUP();
+       p_RFROM();
+       p_ULESS();
+       A_EXIT(0x22e);
+    return 0x22f;
+}
+
+IU a_022f() {    /// : NUMBER? ;
+    IU ip;
+L022f: A_CALL(0x22f, a_00f2);
+L0231: p_AT();
+L0232: p_TOR();
+L0233: PUSH(0x0);
+L0235: p_OVER();
+L0236: p_COUNT();
+L0237: p_OVER();
+L0238: p_CAT();
+L0239: PUSH(0x24);
+L023b: p_EQ();
+L023c: if (!T) { POP(); goto L0245; } POP();
+L023f: A_CALL(0x23f, a_020b);
+L0241: p_SWAP();
+L0242: p_ONEP();
+L0243: p_SWAP();
+L0244: p_ONEM();
+L0245: p_OVER();
+L0246: p_CAT();
+L0247: PUSH(0x2d);
+L0249: p_EQ();
+L024a: p_TOR();
+L024b: p_SWAP();
+L024c: p_RAT();
+L024d: p_SUB();
+L024e: p_SWAP();
+L024f: p_RAT();
+L0250: p_ADD();
+L0251: p_QDUP();
+L0252: if (!T) { POP(); goto L0280; } POP();
+L0255: p_ONEM();
+L0256: p_TOR();
+L0257: p_DUP();
+L0258: p_TOR();
+L0259: p_CAT();
+L025a: A_CALL(0x25a, a_00f2);
+L025c: p_AT();
+L025d: A_CALL(0x25d, a_0217);
+L025f: if (!T) { POP(); goto L0277; } POP();
+L0262: p_SWAP();
+L0263: A_CALL(0x263, a_00f2);
+L0265: p_AT();
+L0266: p_MUL();
+L0267: p_ADD();
+L0268: p_RFROM();
+L0269: p_ONEP();
+L026a: if (I-- > 0) { A_LOOP(0x257, L0257); } RPOP();
+L026d: p_DROP();
+L026e: p_RAT();
+L026f: if (!T) { POP(); goto L0273; } POP();
+L0272: p_NEG();
+L0273: p_SWAP();
+L0274: goto L027f;
+L0277: p_RFROM();
+L0278: p_RFROM();
+L0279: A_CALL(0x279, a_00b4);
+L027b: A_CALL(0x27b, a_00b4);
+L027d: PUSH(0x0);
+L027f: p_DUP();
+L0280: p_RFROM();
+L0281: A_CALL(0x281, a_00b4);
+L0283: p_RFROM();
+L0284: A_CALL(0x284, a_00f2);
+L0286: p_STORE();
+L0287: A_EXIT(0x287);
+    return 0x288;
+resume:
+    switch (ip) {
+    case 0x22f: goto L022f;
+    case 0x231: goto L0231;
+    case 0x232: goto L0232;
+    case 0x233: goto L0233;
+    case 0x235: goto L0235;
+    case 0x236: goto L0236;
+    case 0x237: goto L0237;
+    case 0x238: goto L0238;
+    case 0x239: goto L0239;
+    case 0x23b: goto L023b;
+    case 0x23c: goto L023c;
+    case 0x23f: goto L023f;
+    case 0x241: goto L0241;
+    case 0x242: goto L0242;
+    case 0x243: goto L0243;
+    case 0x244: goto L0244;
+    case 0x245: goto L0245;
+    case 0x246: goto L0246;
+    case 0x247: goto L0247;
+    case 0x249: goto L0249;
+    case 0x24a: goto L024a;
+    case 0x24b: goto L024b;
+    case 0x24c: goto L024c;
+    case 0x24d: goto L024d;
+    case 0x24e: goto L024e;
+    case 0x24f: goto L024f;
+    case 0x250: goto L0250;
+    case 0x251: goto L0251;
+    case 0x252: goto L0252;
+    case 0x255: goto L0255;
+    case 0x256: goto L0256;
+    case 0x257: goto L0257;
+    case 0x258: goto L0258;
+    case 0x259: goto L0259;
+    case 0x25a: goto L025a;
+    case 0x25c: goto L025c;
+    case 0x25d: goto L025d;
+    case 0x25f: goto L025f;
+    case 0x262: goto L0262;
+    case 0x263: goto L0263;
+    case 0x265: goto L0265;
+    case 0x266: goto L0266;
+    case 0x267: goto L0267;
+    case 0x268: goto L0268;
+    case 0x269: goto L0269;
+    case 0x26a: goto L026a;
+    case 0x26d: goto L026d;
+    case 0x26e: goto L026e;
+    case 0x26f: goto L026f;
+    case 0x272: goto L0272;
+    case 0x273: goto L0273;
+    case 0x274: goto L0274;
+    case 0x277: goto L0277;
+    case 0x278: goto L0278;
+    case 0x279: goto L0279;
+    case 0x27b: goto L027b;
+    case 0x27d: goto L027d;
+    case 0x27f: goto L027f;
+    case 0x280: goto L0280;
+    case 0x281: goto L0281;
+    case 0x283: goto L0283;
+    case 0x284: goto L0284;
+    case 0x286: goto L0286;
+    case 0x287: goto L0287;
+    }
+    return ip;
+}
+
+IU a_0288() {    /// : SPACE ;
+       p_BL();
+       p_TXSTO();
+       A_EXIT(0x28a);
+    return 0x28b;
+}
+
+IU a_028b() {    /// : CHARS ;
+       p_SWAP();
+       PUSH(0x0);
+       p_MAX();
+       p_TOR();
+       goto L0295;
+L0293: p_DUP();
+       p_TXSTO();
+L0295: if (I-- > 0) { A_LOOP(0x293, L0293); } RPOP();
+       p_DROP();
+       A_EXIT(0x299);
+    return 0x29a;
+}
+
+IU a_029a() {    /// : SPACES ;
+    IU ip;
+L029a: p_BL();
+L029b: A_CALL(0x29b, a_028b);
+L029d: A_EXIT(0x29d);
+    return 0x29e;
+resume:
+    switch (ip) {
+    case 0x29a: goto L029a;
+    case 0x29b: goto L029b;
+    case 0x29d: goto L029d;
+    }
+    return ip;
+}
+
+IU a_029e() {    /// : TYPE ;
+    IU ip;
+L029e: p_TOR();
+L029f: goto L02a6;
+L02a2: p_COUNT();
+L02a3: A_CALL(0x2a3, a_0153);
+L02a5: p_TXSTO();
+L02a6: if (I-- > 0) { A_LOOP(0x2a2, L02a2); } RPOP();
+L02a9: p_DROP();
+L02aa: A_EXIT(0x2aa);
+    return 0x2ab;
+resume:
+    switch (ip) {
+    case 0x29e: goto L029e;
+    case 0x29f: goto L029f;
+    case 0x2a2: goto L02a2;
+    case 0x2a3: goto L02a3;
+    case 0x2a5: goto L02a5;
+    case 0x2a6: goto L02a6;
+    case 0x2a9: goto L02a9;
+    case 0x2aa: goto L02aa;
+    }
+    return ip;
+}
+
+IU a_02ab() {    /// : CR ;
+       PUSH(0xd);
+       p_TXSTO();
+       PUSH(0xa);
+       p_TXSTO();
+       A_EXIT(0x2b1);
+    return 0x2b2;
+}
+
+IU a_02b2() {    /// : do$ ;
+       p_RFROM();
+       p_RAT();
+       p_RFROM();
+       p_COUNT();
+       p_ADD();
+       p_TOR();
+       p_SWAP();
+       p_TOR();
+       p_COUNT();
+       A_EXIT(0x2bb);
+    return 0x2bc;
+}
+
+IU a_02bc() {    /// : $"| ;
+    IU ip;
+L02bc: A_CALL(0x2bc, a_02b2);
+L02be: A_EXIT(0x2be);
+    return 0x2bf;
+resume:
+    switch (ip) {
+    case 0x2bc: goto L02bc;
+    case 0x2be: goto L02be;
+    }
+    return ip;
+}
+
+IU a_02bf() {    /// : ."| ;
+    IU ip;
+L02bf: A_CALL(0x2bf, a_02b2);
+L02c1: A_CALL(0x2c1, a_029e);
+L02c3: A_EXIT(0x2c3);
+    return 0x2c4;
+resume:
+    switch (ip) {
+    case 0x2bf: goto L02bf;
+    case 0x2c1: goto L02c1;
+    case 0x2c3: goto L02c3;
+    }
+    return ip;
+}
+
+IU a_02c4() {    /// : .R ;
+    IU ip;
+L02c4: p_TOR();
+L02c5: A_CALL(0x2c5, a_0207);
+L02c7: p_RFROM();
+L02c8: p_OVER();
+L02c9: p_SUB();
+L02ca: A_CALL(0x2ca, a_029a);
+L02cc: A_CALL(0x2cc, a_029e);
+L02ce: A_EXIT(0x2ce);
+    return 0x2cf;
+resume:
+    switch (ip) {
+    case 0x2c4: goto L02c4;
+    case 0x2c5: goto L02c5;
+    case 0x2c7: goto L02c7;
+    case 0x2c8: goto L02c8;
+    case 0x2c9: goto L02c9;
+    case 0x2ca: goto L02ca;
+    case 0x2cc: goto L02cc;
+    case 0x2ce: goto L02ce;
+    }
+    return ip;
+}
+
+IU a_02cf() {    /// : U.R ;
+    IU ip;
+L02cf: p_TOR();
+L02d0: p_S2D();
+L02d1: A_CALL(0x2d1, a_01c0);
+L02d3: A_CALL(0x2d3, a_01e0);
+L02d5: A_CALL(0x2d5, a_01ee);
+L02d7: p_RFROM();
+L02d8: p_OVER();
+L02d9: p_SUB();
+L02da: A_CALL(0x2da, a_029a);
+L02dc: A_CALL(0x2dc, a_029e);
+L02de: A_EXIT(0x2de);
+    return 0x2df;
+resume:
+    switch (ip) {
+    case 0x2cf: goto L02cf;
+    case 0x2d0: goto L02d0;
+    case 0x2d1: goto L02d1;
+    case 0x2d3: goto L02d3;
+    case 0x2d5: goto L02d5;
+    case 0x2d7: goto L02d7;
+    case 0x2d8: goto L02d8;
+    case 0x2d9: goto L02d9;
+    case 0x2da: goto L02da;
+    case 0x2dc: goto L02dc;
+    case 0x2de: goto L02de;
+    }
+    return ip;
+}
+
+IU a_02df() {    /// : U. ;
+    IU ip;
+L02df: PUSH(0x1);
+L02e1: A_CALL(0x2e1, a_02cf);
+L02e3: A_EXIT(0x2e3);
+    return 0x2e4;
+resume:
+    switch (ip) {
+    case 0x2df: goto L02df;
+    case 0x2e1: goto L02e1;
+    case 0x2e3: goto L02e3;
+    }
+    return ip;
+}
+
+IU a_02e4() {    /// : . ;
+    IU ip;
+L02e4: A_CALL(0x2e4, a_0207);
+L02e6: A_CALL(0x2e6, a_0288);
+L02e8: A_CALL(0x2e8, a_029e);
+L02ea: A_EXIT(0x2ea);
+    return 0x2eb;
+resume:
+    switch (ip) {
+    case 0x2e4: goto L02e4;
+    case 0x2e6: goto L02e6;
+    case 0x2e8: goto L02e8;
+    case 0x2ea: goto L02ea;
+    }
+    return ip;
+}
+
+IU a_02eb() {    /// : ? ;
+    IU ip;
+L02eb: p_AT();
+L02ec: A_CALL(0x2ec, a_02e4);
+L02ee: A_EXIT(0x2ee);
+    return 0x2ef;
+resume:
+    switch (ip) {
+    case 0x2eb: goto L02eb;
+    case 0x2ec: goto L02ec;
+    case 0x2ee: goto L02ee;
+    }
+    return ip;
+}
+
+IU a_02ef() {    /// : (parse) ;
+    IU ip;
+L02ef: A_CALL(0x2ef, a_011a);
+L02f1: p_CSTOR();
+L02f2: p_OVER();
+L02f3: p_TOR();
+L02f4: p_DUP();
+L02f5: if (!T) { POP(); goto L033f; } POP();
+L02f8: p_ONEM();
+L02f9: A_CALL(0x2f9, a_011a);
+L02fb: p_CAT();
+L02fc: p_BL();
+L02fd: p_EQ();
+L02fe: if (!T) { POP(); goto L0316; } POP();
+L0301: p_TOR();
+L0302: p_BL();
+L0303: p_OVER();
+L0304: p_CAT();
+L0305: p_SUB();
+L0306: p_ZLT();
+L0307: p_INV();
+L0308: if (!T) { POP(); goto L0315; } POP();
+L030b: p_ONEP();
+L030c: if (I-- > 0) { A_LOOP(0x302, L0302); } RPOP();
+L030f: p_RFROM();
+L0310: p_DROP();
+L0311: PUSH(0x0);
+L0313: p_DUP();
+L0314: A_EXIT(0x314);
+L0315: p_RFROM();
+L0316: p_OVER();
+L0317: p_SWAP();
+L0318: p_TOR();
+L0319: A_CALL(0x319, a_011a);
+L031b: p_CAT();
+L031c: p_OVER();
+L031d: p_CAT();
+L031e: p_SUB();
+L031f: A_CALL(0x31f, a_011a);
+L0321: p_CAT();
+L0322: p_BL();
+L0323: p_EQ();
+L0324: if (!T) { POP(); goto L0328; } POP();
+L0327: p_ZLT();
+L0328: if (!T) { POP(); goto L0334; } POP();
+L032b: p_ONEP();
+L032c: if (I-- > 0) { A_LOOP(0x319, L0319); } RPOP();
+L032f: p_DUP();
+L0330: p_TOR();
+L0331: goto L0339;
+L0334: p_RFROM();
+L0335: p_DROP();
+L0336: p_DUP();
+L0337: p_ONEP();
+L0338: p_TOR();
+L0339: p_OVER();
+L033a: p_SUB();
+L033b: p_RFROM();
+L033c: p_RFROM();
+L033d: p_SUB();
+L033e: A_EXIT(0x33e);
+L033f: p_OVER();
+L0340: p_RFROM();
+L0341: p_SUB();
+L0342: A_EXIT(0x342);
+    return 0x343;
+resume:
+    switch (ip) {
+    case 0x2ef: goto L02ef;
+    case 0x2f1: goto L02f1;
+    case 0x2f2: goto L02f2;
+    case 0x2f3: goto L02f3;
+    case 0x2f4: goto L02f4;
+    case 0x2f5: goto L02f5;
+    case 0x2f8: goto L02f8;
+    case 0x2f9: goto L02f9;
+    case 0x2fb: goto L02fb;
+    case 0x2fc: goto L02fc;
+    case 0x2fd: goto L02fd;
+    case 0x2fe: goto L02fe;
+    case 0x301: goto L0301;
+    case 0x302: goto L0302;
+    case 0x303: goto L0303;
+    case 0x304: goto L0304;
+    case 0x305: goto L0305;
+    case 0x306: goto L0306;
+    case 0x307: goto L0307;
+    case 0x308: goto L0308;
+    case 0x30b: goto L030b;
+    case 0x30c: goto L030c;
+    case 0x30f: goto L030f;
+    case 0x310: goto L0310;
+    case 0x311: goto L0311;
+    case 0x313: goto L0313;
+    case 0x314: goto L0314;
+    case 0x315: goto L0315;
+    case 0x316: goto L0316;
+    case 0x317: goto L0317;
+    case 0x318: goto L0318;
+    case 0x319: goto L0319;
+    case 0x31b: goto L031b;
+    case 0x31c: goto L031c;
+    case 0x31d: goto L031d;
+    case 0x31e: goto L031e;
+    case 0x31f: goto L031f;
+    case 0x321: goto L0321;
+    case 0x322: goto L0322;
+    case 0x323: goto L0323;
+    case 0x324: goto L0324;
+    case 0x327: goto L0327;
+    case 0x328: goto L0328;
+    case 0x32b: goto L032b;
+    case 0x32c: goto L032c;
+    case 0x32f: goto L032f;
+    case 0x330: goto L0330;
+    case 0x331: goto L0331;
+    case 0x334: goto L0334;
+    case 0x335: goto L0335;
+    case 0x336: goto L0336;
+    case 0x337: goto L0337;
+    case 0x338: goto L0338;
+    case 0x339: goto L0339;
+    case 0x33a: goto L033a;
+    case 0x33b: goto L033b;
+    case 0x33c: goto L033c;
+    case 0x33d: goto L033d;
+    case 0x33e: goto L033e;
+    case 0x33f: goto L033f;
+    case 0x340: goto L0340;
+    case 0x341: goto L0341;
+    case 0x342: goto L0342;
+    }
+    return ip;
+}
+
+IU a_0343() {    /// : PACK$ ;
+    IU ip;
+L0343: p_DUP();
+L0344: p_TOR();
+L0345: A_CALL(0x345, a_00b1);
+L0347: p_CSTOR();
+L0348: p_ONEP();
+L0349: p_SWAP();
+L034a: A_CALL(0x34a, a_0172);
+L034c: p_RFROM();
+L034d: A_EXIT(0x34d);
+    return 0x34e;
+resume:
+    switch (ip) {
+    case 0x343: goto L0343;
+    case 0x344: goto L0344;
+    case 0x345: goto L0345;
+    case 0x347: goto L0347;
+    case 0x348: goto L0348;
+    case 0x349: goto L0349;
+    case 0x34a: goto L034a;
+    case 0x34c: goto L034c;
+    case 0x34d: goto L034d;
+    }
+    return ip;
+}
+
+IU a_034e() {    /// : PARSE ;
+    IU ip;
+L034e: p_TOR();
+L034f: A_CALL(0x34f, a_016e);
+L0351: A_CALL(0x351, a_0112);
+L0353: p_AT();
+L0354: p_ADD();
+L0355: A_CALL(0x355, a_0116);
+L0357: p_AT();
+L0358: A_CALL(0x358, a_0112);
+L035a: p_AT();
+L035b: p_SUB();
+L035c: p_RFROM();
+L035d: A_CALL(0x35d, a_02ef);
+L035f: A_CALL(0x35f, a_0112);
+L0361: p_PSTOR();
+L0362: A_EXIT(0x362);
+    return 0x363;
+resume:
+    switch (ip) {
+    case 0x34e: goto L034e;
+    case 0x34f: goto L034f;
+    case 0x351: goto L0351;
+    case 0x353: goto L0353;
+    case 0x354: goto L0354;
+    case 0x355: goto L0355;
+    case 0x357: goto L0357;
+    case 0x358: goto L0358;
+    case 0x35a: goto L035a;
+    case 0x35b: goto L035b;
+    case 0x35c: goto L035c;
+    case 0x35d: goto L035d;
+    case 0x35f: goto L035f;
+    case 0x361: goto L0361;
+    case 0x362: goto L0362;
+    }
+    return ip;
+}
+
+IU a_0363() {    /// : TOKEN ;
+    IU ip;
+L0363: p_BL();
+L0364: A_CALL(0x364, a_034e);
+L0366: PUSH(0x1f);
+L0368: p_MIN();
+L0369: A_CALL(0x369, a_0162);
+L036b: p_CELL();
+L036c: p_ADD();
+L036d: A_CALL(0x36d, a_0343);
+L036f: A_EXIT(0x36f);
+    return 0x370;
+resume:
+    switch (ip) {
+    case 0x363: goto L0363;
+    case 0x364: goto L0364;
+    case 0x366: goto L0366;
+    case 0x368: goto L0368;
+    case 0x369: goto L0369;
+    case 0x36b: goto L036b;
+    case 0x36c: goto L036c;
+    case 0x36d: goto L036d;
+    case 0x36f: goto L036f;
+    }
+    return ip;
+}
+
+IU a_0370() {    /// : WORD ;
+    IU ip;
+L0370: A_CALL(0x370, a_034e);
+L0372: A_CALL(0x372, a_0162);
+L0374: p_CELL();
+L0375: p_ADD();
+L0376: A_CALL(0x376, a_0343);
+L0378: A_EXIT(0x378);
+    return 0x379;
+resume:
+    switch (ip) {
+    case 0x370: goto L0370;
+    case 0x372: goto L0372;
+    case 0x374: goto L0374;
+    case 0x375: goto L0375;
+    case 0x376: goto L0376;
+    case 0x378: goto L0378;
+    }
+    return ip;
+}
+
+IU a_0379() {    /// : NAME> ;
+       p_DUP();
+       p_CAT();
+       PUSH(0x20);
+       p_AND();
+       p_SWAP();
+       p_COUNT();
+       PUSH(0x1f);
+       p_AND();
+       p_ADD();
+       p_SWAP();
+       if (!T) { POP(); goto L0389; } POP();
+       p_AT();
+L0389: A_EXIT(0x389);
+    return 0x38a;
+}
+
+IU a_038a() {    /// : SAME? ;
+    IU ip;
+L038a: p_TOR();
+L038b: A_CALL(0x38b, a_00b1);
+L038d: goto L03aa;
+L0390: p_DUP();
+L0391: p_CAT();
+L0392: p_TOUPP();
+L0393: p_TOR();
+L0394: p_ONEP();
+L0395: p_SWAP();
+L0396: p_DUP();
+L0397: p_CAT();
+L0398: p_TOUPP();
+L0399: p_TOR();
+L039a: p_ONEP();
+L039b: p_SWAP();
+L039c: p_RFROM();
+L039d: p_RFROM();
+L039e: p_SUB();
+L039f: p_QDUP();
+L03a0: if (!T) { POP(); goto L03aa; } POP();
+L03a3: p_RFROM();
+L03a4: p_DROP();
+L03a5: p_TOR();
+L03a6: A_CALL(0x3a6, a_00b4);
+L03a8: p_RFROM();
+L03a9: A_EXIT(0x3a9);
+L03aa: if (I-- > 0) { A_LOOP(0x390, L0390); } RPOP();
+L03ad: A_CALL(0x3ad, a_00b4);
+L03af: PUSH(0x0);
+L03b1: A_EXIT(0x3b1);
+    return 0x3b2;
+resume:
+    switch (ip) {
+    case 0x38a: goto L038a;
+    case 0x38b: goto L038b;
+    case 0x38d: goto L038d;
+    case 0x390: goto L0390;
+    case 0x391: goto L0391;
+    case 0x392: goto L0392;
+    case 0x393: goto L0393;
+    case 0x394: goto L0394;
+    case 0x395: goto L0395;
+    case 0x396: goto L0396;
+    case 0x397: goto L0397;
+    case 0x398: goto L0398;
+    case 0x399: goto L0399;
+    case 0x39a: goto L039a;
+    case 0x39b: goto L039b;
+    case 0x39c: goto L039c;
+    case 0x39d: goto L039d;
+    case 0x39e: goto L039e;
+    case 0x39f: goto L039f;
+    case 0x3a0: goto L03a0;
+    case 0x3a3: goto L03a3;
+    case 0x3a4: goto L03a4;
+    case 0x3a5: goto L03a5;
+    case 0x3a6: goto L03a6;
+    case 0x3a8: goto L03a8;
+    case 0x3a9: goto L03a9;
+    case 0x3aa: goto L03aa;
+    case 0x3ad: goto L03ad;
+    case 0x3af: goto L03af;
+    case 0x3b1: goto L03b1;
+    }
+    return ip;
+}
+
+IU a_03b2() {    /// : FIND ;
+    IU ip;
+L03b2: p_SWAP();
+L03b3: p_DUP();
+L03b4: p_CAT();
+L03b5: A_CALL(0x3b5, a_011a);
+L03b7: p_STORE();
+L03b8: p_DUP();
+L03b9: p_AT();
+L03ba: p_TOR();
+L03bb: p_CELL();
+L03bc: p_ADD();
+L03bd: p_SWAP();
+L03be: p_AT();
+L03bf: p_DUP();
+L03c0: if (!T) { POP(); goto L03ed; } POP();
+L03c3: p_DUP();
+L03c4: p_AT();
+L03c5: PUSH((DU)0x1fff);
+L03c8: p_AND();
+L03c9: PUSH((DU)0x5f5f);
+L03cc: p_AND();
+L03cd: p_RAT();
+L03ce: PUSH((DU)0x5f5f);
+L03d1: p_AND();
+L03d2: p_XOR();
+L03d3: if (!T) { POP(); goto L03de; } POP();
+L03d6: p_CELL();
+L03d7: p_ADD();
+L03d8: PUSH((DU)0xffff);
+L03db: goto L03ea;
+L03de: p_CELL();
+L03df: p_ADD();
+L03e0: A_CALL(0x3e0, a_011a);
+L03e2: p_AT();
+L03e3: p_ONEM();
+L03e4: p_DUP();
+L03e5: if (!T) { POP(); goto L03ea; } POP();
+L03e8: A_CALL(0x3e8, a_038a);
+L03ea: goto L03f4;
+L03ed: p_RFROM();
+L03ee: p_DROP();
+L03ef: p_SWAP();
+L03f0: p_CELL();
+L03f1: p_SUB();
+L03f2: p_SWAP();
+L03f3: A_EXIT(0x3f3);
+L03f4: if (!T) { POP(); goto L03fe; } POP();
+L03f7: p_CELL();
+L03f8: p_SUB();
+L03f9: p_CELL();
+L03fa: p_SUB();
+L03fb: A_LOOP(0x3be, L03be);
+L03fe: p_RFROM();
+L03ff: p_DROP();
+L0400: p_SWAP();
+L0401: p_DROP();
+L0402: p_CELL();
+L0403: p_SUB();
+L0404: p_DUP();
+L0405: A_CALL(0x405, a_0379);
+L0407: p_SWAP();
+L0408: A_EXIT(0x408);
+    return 0x409;
+resume:
+    switch (ip) {
+    case 0x3b2: goto L03b2;
+    case 0x3b3: goto L03b3;
+    case 0x3b4: goto L03b4;
+    case 0x3b5: goto L03b5;
+    case 0x3b7: goto L03b7;
+    case 0x3b8: goto L03b8;
+    case 0x3b9: goto L03b9;
+    case 0x3ba: goto L03ba;
+    case 0x3bb: goto L03bb;
+    case 0x3bc: goto L03bc;
+    case 0x3bd: goto L03bd;
+    case 0x3be: goto L03be;
+    case 0x3bf: goto L03bf;
+    case 0x3c0: goto L03c0;
+    case 0x3c3: goto L03c3;
+    case 0x3c4: goto L03c4;
+    case 0x3c5: goto L03c5;
+    case 0x3c8: goto L03c8;
+    case 0x3c9: goto L03c9;
+    case 0x3cc: goto L03cc;
+    case 0x3cd: goto L03cd;
+    case 0x3ce: goto L03ce;
+    case 0x3d1: goto L03d1;
+    case 0x3d2: goto L03d2;
+    case 0x3d3: goto L03d3;
+    case 0x3d6: goto L03d6;
+    case 0x3d7: goto L03d7;
+    case 0x3d8: goto L03d8;
+    case 0x3db: goto L03db;
+    case 0x3de: goto L03de;
+    case 0x3df: goto L03df;
+    case 0x3e0: goto L03e0;
+    case 0x3e2: goto L03e2;
+    case 0x3e3: goto L03e3;
+    case 0x3e4: goto L03e4;
+    case 0x3e5: goto L03e5;
+    case 0x3e8: goto L03e8;
+    case 0x3ea: goto L03ea;
+    case 0x3ed: goto L03ed;
+    case 0x3ee: goto L03ee;
+    case 0x3ef: goto L03ef;
+    case 0x3f0: goto L03f0;
+    case 0x3f1: goto L03f1;
+    case 0x3f2: goto L03f2;
+    case 0x3f3: goto L03f3;
+    case 0x3f4: goto L03f4;
+    case 0x3f7: goto L03f7;
+    case 0x3f8: goto L03f8;
+    case 0x3f9: goto L03f9;
+    case 0x3fa: goto L03fa;
+    case 0x3fb: goto L03fb;
+    case 0x3fe: goto L03fe;
+    case 0x3ff: goto L03ff;
+    case 0x400: goto L0400;
+    case 0x401: goto L0401;
+    case 0x402: goto L0402;
+    case 0x403: goto L0403;
+    case 0x404: goto L0404;
+    case 0x405: goto L0405;
+    case 0x407: goto L0407;
+    case 0x408: goto L0408;
+    }
+    return ip;
+}
+
+IU a_0409() {    /// : NAME? ;
+    IU ip;
+L0409: A_CALL(0x409, a_013e);
+L040b: PUSH(0x7);
+L040d: p_TOR();
+L040e: p_DUP();
+L040f: p_AT();
+L0410: p_QDUP();
+L0411: if (!T) { POP(); goto L0427; } POP();
+L0414: p_ROT();
+L0415: p_SWAP();
+L0416: A_CALL(0x416, a_03b2);
+L0418: p_QDUP();
+L0419: if (!T) { POP(); goto L0421; } POP();
+L041c: p_ROT();
+L041d: p_DROP();
+L041e: p_RFROM();
+L041f: p_DROP();
+L0420: A_EXIT(0x420);
+L0421: p_SWAP();
+L0422: p_CELL();
+L0423: p_ADD();
+L0424: goto L042d;
+L0427: p_RFROM();
+L0428: p_DROP();
+L0429: p_DROP();
+L042a: PUSH(0x0);
+L042c: A_EXIT(0x42c);
+L042d: if (I-- > 0) { A_LOOP(0x40e, L040e); } RPOP();
+L0430: p_DROP();
+L0431: PUSH(0x0);
+L0433: A_EXIT(0x433);
+    return 0x434;
+resume:
+    switch (ip) {
+    case 0x409: goto L0409;
+    case 0x40b: goto L040b;
+    case 0x40d: goto L040d;
+    case 0x40e: goto L040e;
+    case 0x40f: goto L040f;
+    case 0x410: goto L0410;
+    case 0x411: goto L0411;
+    case 0x414: goto L0414;
+    case 0x415: goto L0415;
+    case 0x416: goto L0416;
+    case 0x418: goto L0418;
+    case 0x419: goto L0419;
+    case 0x41c: goto L041c;
+    case 0x41d: goto L041d;
+    case 0x41e: goto L041e;
+    case 0x41f: goto L041f;
+    case 0x420: goto L0420;
+    case 0x421: goto L0421;
+    case 0x422: goto L0422;
+    case 0x423: goto L0423;
+    case 0x424: goto L0424;
+    case 0x427: goto L0427;
+    case 0x428: goto L0428;
+    case 0x429: goto L0429;
+    case 0x42a: goto L042a;
+    case 0x42c: goto L042c;
+    case 0x42d: goto L042d;
+    case 0x430: goto L0430;
+    case 0x431: goto L0431;
+    case 0x433: goto L0433;
+    }
+    return ip;
+}
+
+IU a_0434() {    /// : ^H ;
+       p_TOR();
+       p_OVER();
+       p_RFROM();
+       p_SWAP();
+       p_OVER();
+       p_XOR();
+       if (!T) { POP(); goto L0446; } POP();
+       PUSH(0x8);
+       p_TXSTO();
+       p_ONEM();
+       p_BL();
+       p_TXSTO();
+       PUSH(0x8);
+       p_TXSTO();
+L0446: A_EXIT(0x446);
+    return 0x447;
+}
+
+IU a_0447() {    /// : TAP ;
+       p_DUP();
+       p_TXSTO();
+       p_OVER();
+       p_CSTOR();
+       p_ONEP();
+       A_EXIT(0x44c);
+    return 0x44d;
+}
+
+IU a_044d() {    /// : kTAP ;
+    IU ip;
+L044d: p_DUP();
+L044e: PUSH(0xa);
+L0450: p_XOR();
+L0451: if (!T) { POP(); goto L0463; } POP();
+L0454: PUSH(0x8);
+L0456: p_XOR();
+L0457: if (!T) { POP(); goto L0460; } POP();
+L045a: p_BL();
+L045b: A_CALL(0x45b, a_0447);
+L045d: goto L0462;
+L0460: A_CALL(0x460, a_0434);
+L0462: A_EXIT(0x462);
+L0463: p_DROP();
+L0464: p_SWAP();
+L0465: p_DROP();
+L0466: p_DUP();
+L0467: A_EXIT(0x467);
+    return 0x468;
+resume:
+    switch (ip) {
+    case 0x44d: goto L044d;
+    case 0x44e: goto L044e;
+    case 0x450: goto L0450;
+    case 0x451: goto L0451;
+    case 0x454: goto L0454;
+    case 0x456: goto L0456;
+    case 0x457: goto L0457;
+    case 0x45a: goto L045a;
+    case 0x45b: goto L045b;
+    case 0x45d: goto L045d;
+    case 0x460: goto L0460;
+    case 0x462: goto L0462;
+    case 0x463: goto L0463;
+    case 0x464: goto L0464;
+    case 0x465: goto L0465;
+    case 0x466: goto L0466;
+    case 0x467: goto L0467;
+    }
+    return ip;
+}
+
+IU a_0468() {    /// : ACCEPT ;
+    IU ip;
+L0468: p_OVER();
+L0469: p_ADD();
+L046a: p_OVER();
+L046b: A_CALL(0x46b, a_00b1);
+L046d: p_XOR();
+L046e: if (!T) { POP(); goto L0486; } POP();
+L0471: A_CALL(0x471, a_014e);
+L0473: p_DUP();
+L0474: p_BL();
+L0475: p_SUB();
+L0476: PUSH(0x5f);
+L0478: p_ULESS();
+L0479: if (!T) { POP(); goto L0481; } POP();
+L047c: A_CALL(0x47c, a_0447);
+L047e: goto L0483;
+L0481: A_CALL(0x481, a_044d);
+L0483: A_LOOP(0x46b, L046b);
+L0486: p_DROP();
+L0487: p_OVER();
+L0488: p_SUB();
+L0489: A_EXIT(0x489);
+    return 0x48a;
+resume:
+    switch (ip) {
+    case 0x468: goto L0468;
+    case 0x469: goto L0469;
+    case 0x46a: goto L046a;
+    case 0x46b: goto L046b;
+    case 0x46d: goto L046d;
+    case 0x46e: goto L046e;
+    case 0x471: goto L0471;
+    case 0x473: goto L0473;
+    case 0x474: goto L0474;
+    case 0x475: goto L0475;
+    case 0x476: goto L0476;
+    case 0x478: goto L0478;
+    case 0x479: goto L0479;
+    case 0x47c: goto L047c;
+    case 0x47e: goto L047e;
+    case 0x481: goto L0481;
+    case 0x483: goto L0483;
+    case 0x486: goto L0486;
+    case 0x487: goto L0487;
+    case 0x488: goto L0488;
+    case 0x489: goto L0489;
+    }
+    return ip;
+}
+
+IU a_048a() {    /// : EXPECT ;
+    IU ip;
+L048a: A_CALL(0x48a, a_0468);
+L048c: A_CALL(0x48c, a_010e);
+L048e: p_STORE();
+L048f: p_DROP();
+L0490: A_EXIT(0x490);
+    return 0x491;
+resume:
+    switch (ip) {
+    case 0x48a: goto L048a;
+    case 0x48c: goto L048c;
+    case 0x48e: goto L048e;
+    case 0x48f: goto L048f;
+    case 0x490: goto L0490;
+    }
+    return ip;
+}
+
+IU a_0491() {    /// : QUERY ;
+    IU ip;
+L0491: A_CALL(0x491, a_016e);
+L0493: A_CALL(0x493, a_0126);
+L0495: p_AT();
+L0496: A_CALL(0x496, a_0468);
+L0498: A_CALL(0x498, a_0116);
+L049a: p_STORE();
+L049b: p_DROP();
+L049c: PUSH(0x0);
+L049e: A_CALL(0x49e, a_0112);
+L04a0: p_STORE();
+L04a1: A_EXIT(0x4a1);
+    return 0x4a2;
+resume:
+    switch (ip) {
+    case 0x491: goto L0491;
+    case 0x493: goto L0493;
+    case 0x495: goto L0495;
+    case 0x496: goto L0496;
+    case 0x498: goto L0498;
+    case 0x49a: goto L049a;
+    case 0x49b: goto L049b;
+    case 0x49c: goto L049c;
+    case 0x49e: goto L049e;
+    case 0x4a0: goto L04a0;
+    case 0x4a1: goto L04a1;
+    }
+    return ip;
+}
+
+IU a_04a2() {    /// : ABORT ;
+    IU ip;
+L04a2: A_CALL(0x4a2, a_0106);
+L04a4: p_AT();
+L04a5: p_QDUP();
+L04a6: if (!T) { POP(); goto L04aa; } POP();
+L04a9: A_EXEC(0x4a9);
+L04aa: A_EXIT(0x4aa);
+    return 0x4ab;
+resume:
+    switch (ip) {
+    case 0x4a2: goto L04a2;
+    case 0x4a4: goto L04a4;
+    case 0x4a5: goto L04a5;
+    case 0x4a6: goto L04a6;
+    case 0x4a9: goto L04a9;
+    case 0x4aa: goto L04aa;
+    }
+    return ip;
+}
+
+IU a_04ab() {    /// : ?STACK ;
+       return 0x4ab;
+       A_EXIT(0x4ac);
+    return 0x4ad;
+}
+
+IU a_04ad() {    /// : ERROR ;
+    IU ip;
+L04ad: A_CALL(0x4ad, a_0288);
+L04af: p_COUNT();
+L04b0: A_CALL(0x4b0, a_029e);
+L04b2: PUSH(0x3f);
+L04b4: p_TXSTO();
+L04b5: A_CALL(0x4b5, a_02ab);
+L04b7: A_CALL(0x4b7, a_04a2);
+    return 0x4b9;
+resume:
+    switch (ip) {
+    case 0x4ad: goto L04ad;
+    case 0x4af: goto L04af;
+    case 0x4b0: goto L04b0;
+    case 0x4b2: goto L04b2;
+    case 0x4b4: goto L04b4;
+    case 0x4b5: goto L04b5;
+    case 0x4b7: goto L04b7;
+    }
+    return ip;
+}
+
+IU a_04b9() {    /// : $INTERPRET ;
+    IU ip;
+L04b9: A_CALL(0x4b9, a_0409);
+L04bb: p_QDUP();
+L04bc: if (!T) { POP(); goto L04db; } POP();
+L04bf: p_CAT();
+L04c0: PUSH(0x40);
+L04c2: p_AND();
+L04c3: if (!T) { POP(); goto L04d9; } POP();
+L04c6: p_DROP();
+L04c7: A_CALL(0x4c7, a_02bf);
+L04d6: goto L04da;
+L04d9: A_EXEC(0x4d9);
+L04da: A_EXIT(0x4da);
+L04db: A_CALL(0x4db, a_022f);
+L04dd: if (!T) { POP(); goto L04e4; } POP();
+L04e0: A_EXIT(0x4e0);
+L04e1: return 0x4e6;
+L04e4: A_CALL(0x4e4, a_04ad);
+    return 0x4e6;
+resume:
+    switch (ip) {
+    case 0x4b9: goto L04b9;
+    case 0x4bb: goto L04bb;
+    case 0x4bc: goto L04bc;
+    case 0x4bf: goto L04bf;
+    case 0x4c0: goto L04c0;
+    case 0x4c2: goto L04c2;
+    case 0x4c3: goto L04c3;
+    case 0x4c6: goto L04c6;
+    case 0x4c7: goto L04c7;
+    case 0x4d6: goto L04d6;
+    case 0x4d9: goto L04d9;
+    case 0x4da: goto L04da;
+    case 0x4db: goto L04db;
+    case 0x4dd: goto L04dd;
+    case 0x4e0: goto L04e0;
+    case 0x4e1: goto L04e1;
+    case 0x4e4: goto L04e4;
+    }
+    return ip;
+}
+
+IU a_04e6() {    /// : [ ;
+    IU ip;
+L04e6: PUSH((DU)0x4b9);
+L04e9: A_CALL(0x4e9, a_0102);
+L04eb: p_STORE();
+L04ec: A_EXIT(0x4ec);
+    return 0x4ed;
+resume:
+    switch (ip) {
+    case 0x4e6: goto L04e6;
+    case 0x4e9: goto L04e9;
+    case 0x4eb: goto L04eb;
+    case 0x4ec: goto L04ec;
+    }
+    return ip;
+}
+
+IU a_04ed() {    /// : .OK ;
+    IU ip;
+L04ed: A_CALL(0x4ed, a_02ab);
+L04ef: PUSH((DU)0x4b9);
+L04f2: A_CALL(0x4f2, a_0102);
+L04f4: p_AT();
+L04f5: p_EQ();
+L04f6: if (!T) { POP(); goto L050d; } POP();
+L04f9: p_DEPTH();
+L04fa: PUSH(0x4);
+L04fc: p_MIN();
+L04fd: p_TOR();
+L04fe: p_RAT();
+L04ff: p_PICK();
+L0500: A_CALL(0x500, a_02e4);
+L0502: if (I-- > 0) { A_LOOP(0x4fe, L04fe); } RPOP();
+L0505: A_CALL(0x505, a_02bf);
+L050d: A_EXIT(0x50d);
+    return 0x50e;
+resume:
+    switch (ip) {
+    case 0x4ed: goto L04ed;
+    case 0x4ef: goto L04ef;
+    case 0x4f2: goto L04f2;
+    case 0x4f4: goto L04f4;
+    case 0x4f5: goto L04f5;
+    case 0x4f6: goto L04f6;
+    case 0x4f9: goto L04f9;
+    case 0x4fa: goto L04fa;
+    case 0x4fc: goto L04fc;
+    case 0x4fd: goto L04fd;
+    case 0x4fe: goto L04fe;
+    case 0x4ff: goto L04ff;
+    case 0x500: goto L0500;
+    case 0x502: goto L0502;
+    case 0x505: goto L0505;
+    case 0x50d: goto L050d;
+    }
+    return ip;
+}
+
+IU a_050e() {    /// : EVAL ;
+    IU ip;
+L050e: A_CALL(0x50e, a_0363);
+L0510: p_DUP();
+L0511: p_CAT();
+L0512: if (!T) { POP(); goto L0521; } POP();
+L0515: A_CALL(0x515, a_0102);
+L0517: p_AT();
+L0518: p_QDUP();
+L0519: if (!T) { POP(); goto L051d; } POP();
+L051c: A_EXEC(0x51c);
+L051d: return 0x51d;
+L051e: A_LOOP(0x50e, L050e);
+L0521: p_DROP();
+L0522: A_CALL(0x522, a_04ed);
+L0524: A_EXIT(0x524);
+    return 0x525;
+resume:
+    switch (ip) {
+    case 0x50e: goto L050e;
+    case 0x510: goto L0510;
+    case 0x511: goto L0511;
+    case 0x512: goto L0512;
+    case 0x515: goto L0515;
+    case 0x517: goto L0517;
+    case 0x518: goto L0518;
+    case 0x519: goto L0519;
+    case 0x51c: goto L051c;
+    case 0x51d: goto L051d;
+    case 0x51e: goto L051e;
+    case 0x521: goto L0521;
+    case 0x522: goto L0522;
+    case 0x524: goto L0524;
+    }
+    return ip;
+}
+
+IU a_0525() {    /// : QUIT ;
+    IU ip;
+L0525: A_CALL(0x525, a_0122);
+L0527: p_AT();
+L0528: A_CALL(0x528, a_00ee);
+L052a: p_STORE();
+L052b: A_CALL(0x52b, a_04e6);
+L052d: A_CALL(0x52d, a_0491);
+L052f: A_CALL(0x52f, a_050e);
+L0531: A_LOOP(0x52d, L052d);
+    return 0x534;
+resume:
+    switch (ip) {
+    case 0x525: goto L0525;
+    case 0x527: goto L0527;
+    case 0x528: goto L0528;
+    case 0x52a: goto L052a;
+    case 0x52b: goto L052b;
+    case 0x52d: goto L052d;
+    case 0x52f: goto L052f;
+    case 0x531: goto L0531;
+    }
+    return ip;
+}
+
+IU a_0534() {    /// : , ;
+    IU ip;
+L0534: A_CALL(0x534, a_0162);
+L0536: p_DUP();
+L0537: p_CELL();
+L0538: p_ADD();
+L0539: A_CALL(0x539, a_00f6);
+L053b: p_STORE();
+L053c: p_STORE();
+L053d: A_EXIT(0x53d);
+    return 0x53e;
+resume:
+    switch (ip) {
+    case 0x534: goto L0534;
+    case 0x536: goto L0536;
+    case 0x537: goto L0537;
+    case 0x538: goto L0538;
+    case 0x539: goto L0539;
+    case 0x53b: goto L053b;
+    case 0x53c: goto L053c;
+    case 0x53d: goto L053d;
+    }
+    return ip;
+}
+
+IU a_053e() {    /// : C, ;
+    IU ip;
+L053e: A_CALL(0x53e, a_0162);
+L0540: p_DUP();
+L0541: p_ONEP();
+L0542: A_CALL(0x542, a_00f6);
+L0544: p_STORE();
+L0545: p_CSTOR();
+L0546: A_EXIT(0x546);
+    return 0x547;
+resume:
+    switch (ip) {
+    case 0x53e: goto L053e;
+    case 0x540: goto L0540;
+    case 0x541: goto L0541;
+    case 0x542: goto L0542;
+    case 0x544: goto L0544;
+    case 0x545: goto L0545;
+    case 0x546: goto L0546;
+    }
+    return ip;
+}
+
+IU a_0547() {    /// : ALLOT ;
+    IU ip;
+L0547: A_CALL(0x547, a_00f6);
+L0549: p_PSTOR();
+L054a: A_EXIT(0x54a);
+    return 0x54b;
+resume:
+    switch (ip) {
+    case 0x547: goto L0547;
+    case 0x549: goto L0549;
+    case 0x54a: goto L054a;
+    }
+    return ip;
+}
+
+IU a_054b() {    /// : COMPILE, ;
+    IU ip;
+L054b: A_CALL(0x54b, a_0162);
+L054d: A_CALL(0x54d, a_0142);
+L054f: p_STORE();
+L0550: p_DUP();
+L0551: PUSH(0x8);
+L0553: p_RSH();
+L0554: PUSH(0x80);
+L0556: p_OR();
+L0557: A_CALL(0x557, a_053e);
+L0559: A_CALL(0x559, a_053e);
+L055b: A_EXIT(0x55b);
+    return 0x55c;
+resume:
+    switch (ip) {
+    case 0x54b: goto L054b;
+    case 0x54d: goto L054d;
+    case 0x54f: goto L054f;
+    case 0x550: goto L0550;
+    case 0x551: goto L0551;
+    case 0x553: goto L0553;
+    case 0x554: goto L0554;
+    case 0x556: goto L0556;
+    case 0x557: goto L0557;
+    case 0x559: goto L0559;
+    case 0x55b: goto L055b;
+    }
+    return ip;
+}
+
+IU a_055c() {    /// : LITERAL ;
+       p_LITC();
+       A_EXIT(0x55d);
+    return 0x55e;
+}
+
+IU a_055e() {    /// : COMPILE ;
+    IU ip;
+L055e: p_RFROM();
+L055f: p_DUP();
+L0560: p_CAT();
+L0561: A_CALL(0x561, a_053e);
+L0563: p_ONEP();
+L0564: p_TOR();
+L0565: A_EXIT(0x565);
+    return 0x566;
+resume:
+    switch (ip) {
+    case 0x55e: goto L055e;
+    case 0x55f: goto L055f;
+    case 0x560: goto L0560;
+    case 0x561: goto L0561;
+    case 0x563: goto L0563;
+    case 0x564: goto L0564;
+    case 0x565: goto L0565;
+    }
+    return ip;
+}
+
+IU a_0566() {    /// : INLINE, ;
+       p_INL();
+       A_EXIT(0x567);
+    return 0x568;
+}
+
+IU a_0568() {    /// : $COMPILE ;
+    IU ip;
+L0568: A_CALL(0x568, a_0409);
+L056a: p_QDUP();
+L056b: if (!T) { POP(); goto L05a4; } POP();
+L056e: p_CAT();
+L056f: PUSH(0x80);
+L0571: p_AND();
+L0572: if (!T) { POP(); goto L0579; } POP();
+L0575: A_EXEC(0x575);
+L0576: goto L05a3;
+L0579: p_DUP();
+L057a: p_DUP();
+L057b: PUSH((DU)0x2000);
+L057e: p_LT();
+L057f: p_SWAP();
+L0580: p_ONEP();
+L0581: p_CAT();
+L0582: PUSH(0x1);
+L0584: p_EQ();
+L0585: p_AND();
+L0586: p_OVER();
+L0587: p_CAT();
+L0588: PUSH(0x6);
+L058a: PUSH(0x8);
+L058c: p_WITHIN();
+L058d: p_ZEQ();
+L058e: p_AND();
+L058f: if (!T) { POP(); goto L0597; } POP();
+L0592: p_CAT();
+L0593: p_OPC();
+L0594: goto L05a3;
+L0597: p_DUP();
+L0598: p_INL();
+L0599: p_ZEQ();
+L059a: if (!T) { POP(); goto L05a2; } POP();
+L059d: A_CALL(0x59d, a_054b);
+L059f: goto L05a3;
+L05a2: p_DROP();
+L05a3: A_EXIT(0x5a3);
+L05a4: A_CALL(0x5a4, a_022f);
+L05a6: if (!T) { POP(); goto L05ac; } POP();
+L05a9: A_CALL(0x5a9, a_055c);
+L05ab: A_EXIT(0x5ab);
+L05ac: A_CALL(0x5ac, a_04ad);
+    return 0x5ae;
+resume:
+    switch (ip) {
+    case 0x568: goto L0568;
+    case 0x56a: goto L056a;
+    case 0x56b: goto L056b;
+    case 0x56e: goto L056e;
+    case 0x56f: goto L056f;
+    case 0x571: goto L0571;
+    case 0x572: goto L0572;
+    case 0x575: goto L0575;
+    case 0x576: goto L0576;
+    case 0x579: goto L0579;
+    case 0x57a: goto L057a;
+    case 0x57b: goto L057b;
+    case 0x57e: goto L057e;
+    case 0x57f: goto L057f;
+    case 0x580: goto L0580;
+    case 0x581: goto L0581;
+    case 0x582: goto L0582;
+    case 0x584: goto L0584;
+    case 0x585: goto L0585;
+    case 0x586: goto L0586;
+    case 0x587: goto L0587;
+    case 0x588: goto L0588;
+    case 0x58a: goto L058a;
+    case 0x58c: goto L058c;
+    case 0x58d: goto L058d;
+    case 0x58e: goto L058e;
+    case 0x58f: goto L058f;
+    case 0x592: goto L0592;
+    case 0x593: goto L0593;
+    case 0x594: goto L0594;
+    case 0x597: goto L0597;
+    case 0x598: goto L0598;
+    case 0x599: goto L0599;
+    case 0x59a: goto L059a;
+    case 0x59d: goto L059d;
+    case 0x59f: goto L059f;
+    case 0x5a2: goto L05a2;
+    case 0x5a3: goto L05a3;
+    case 0x5a4: goto L05a4;
+    case 0x5a6: goto L05a6;
+    case 0x5a9: goto L05a9;
+    case 0x5ab: goto L05ab;
+    case 0x5ac: goto L05ac;
+    }
+    return ip;
+}
+
+IU a_05ae() {    /// : ?UNIQUE ;
+    IU ip;
+L05ae: p_DUP();
+L05af: A_CALL(0x5af, a_0409);
+L05b1: p_QDUP();
+L05b2: if (!T) { POP(); goto L05c6; } POP();
+L05b5: p_COUNT();
+L05b6: PUSH(0x1f);
+L05b8: p_AND();
+L05b9: A_CALL(0x5b9, a_0288);
+L05bb: A_CALL(0x5bb, a_029e);
+L05bd: A_CALL(0x5bd, a_02bf);
+L05c6: p_DROP();
+L05c7: A_EXIT(0x5c7);
+    return 0x5c8;
+resume:
+    switch (ip) {
+    case 0x5ae: goto L05ae;
+    case 0x5af: goto L05af;
+    case 0x5b1: goto L05b1;
+    case 0x5b2: goto L05b2;
+    case 0x5b5: goto L05b5;
+    case 0x5b6: goto L05b6;
+    case 0x5b8: goto L05b8;
+    case 0x5b9: goto L05b9;
+    case 0x5bb: goto L05bb;
+    case 0x5bd: goto L05bd;
+    case 0x5c6: goto L05c6;
+    case 0x5c7: goto L05c7;
+    }
+    return ip;
+}
+
+IU a_05c8() {    /// : $,h ;
+    IU ip;
+L05c8: p_DUP();
+L05c9: p_CAT();
+L05ca: p_ONEP();
+L05cb: p_TOR();
+L05cc: A_CALL(0x5cc, a_012a);
+L05ce: p_AT();
+L05cf: p_RAT();
+L05d0: p_SUB();
+L05d1: p_CELL();
+L05d2: p_SUB();
+L05d3: p_DUP();
+L05d4: p_CELL();
+L05d5: p_SUB();
+L05d6: A_CALL(0x5d6, a_012a);
+L05d8: p_STORE();
+L05d9: p_SWAP();
+L05da: p_OVER();
+L05db: p_RAT();
+L05dc: A_CALL(0x5dc, a_0172);
+L05de: A_CALL(0x5de, a_0162);
+L05e0: p_OVER();
+L05e1: p_RFROM();
+L05e2: p_ADD();
+L05e3: p_STORE();
+L05e4: p_DUP();
+L05e5: p_CAT();
+L05e6: PUSH(0x20);
+L05e8: p_OR();
+L05e9: p_OVER();
+L05ea: p_CSTOR();
+L05eb: A_EXIT(0x5eb);
+    return 0x5ec;
+resume:
+    switch (ip) {
+    case 0x5c8: goto L05c8;
+    case 0x5c9: goto L05c9;
+    case 0x5ca: goto L05ca;
+    case 0x5cb: goto L05cb;
+    case 0x5cc: goto L05cc;
+    case 0x5ce: goto L05ce;
+    case 0x5cf: goto L05cf;
+    case 0x5d0: goto L05d0;
+    case 0x5d1: goto L05d1;
+    case 0x5d2: goto L05d2;
+    case 0x5d3: goto L05d3;
+    case 0x5d4: goto L05d4;
+    case 0x5d5: goto L05d5;
+    case 0x5d6: goto L05d6;
+    case 0x5d8: goto L05d8;
+    case 0x5d9: goto L05d9;
+    case 0x5da: goto L05da;
+    case 0x5db: goto L05db;
+    case 0x5dc: goto L05dc;
+    case 0x5de: goto L05de;
+    case 0x5e0: goto L05e0;
+    case 0x5e1: goto L05e1;
+    case 0x5e2: goto L05e2;
+    case 0x5e3: goto L05e3;
+    case 0x5e4: goto L05e4;
+    case 0x5e5: goto L05e5;
+    case 0x5e6: goto L05e6;
+    case 0x5e8: goto L05e8;
+    case 0x5e9: goto L05e9;
+    case 0x5ea: goto L05ea;
+    case 0x5eb: goto L05eb;
+    }
+    return ip;
+}
+
+IU a_05ec() {    /// : $,n ;
+    IU ip;
+L05ec: p_DUP();
+L05ed: p_AT();
+L05ee: if (!T) { POP(); goto L05fb; } POP();
+L05f1: A_CALL(0x5f1, a_05ae);
+L05f3: A_CALL(0x5f3, a_012e);
+L05f5: p_AT();
+L05f6: if (!T) { POP(); goto L05fb; } POP();
+L05f9: A_CALL(0x5f9, a_05c8);
+L05fb: p_DUP();
+L05fc: A_CALL(0x5fc, a_0379);
+L05fe: A_CALL(0x5fe, a_00f6);
+L0600: p_STORE();
+L0601: p_DUP();
+L0602: A_CALL(0x602, a_00fe);
+L0604: p_STORE();
+L0605: p_CELL();
+L0606: p_SUB();
+L0607: A_CALL(0x607, a_0136);
+L0609: p_AT();
+L060a: p_AT();
+L060b: p_SWAP();
+L060c: p_STORE();
+L060d: A_EXIT(0x60d);
+L060e: A_CALL(0x60e, a_04ad);
+    return 0x610;
+resume:
+    switch (ip) {
+    case 0x5ec: goto L05ec;
+    case 0x5ed: goto L05ed;
+    case 0x5ee: goto L05ee;
+    case 0x5f1: goto L05f1;
+    case 0x5f3: goto L05f3;
+    case 0x5f5: goto L05f5;
+    case 0x5f6: goto L05f6;
+    case 0x5f9: goto L05f9;
+    case 0x5fb: goto L05fb;
+    case 0x5fc: goto L05fc;
+    case 0x5fe: goto L05fe;
+    case 0x600: goto L0600;
+    case 0x601: goto L0601;
+    case 0x602: goto L0602;
+    case 0x604: goto L0604;
+    case 0x605: goto L0605;
+    case 0x606: goto L0606;
+    case 0x607: goto L0607;
+    case 0x609: goto L0609;
+    case 0x60a: goto L060a;
+    case 0x60b: goto L060b;
+    case 0x60c: goto L060c;
+    case 0x60d: goto L060d;
+    case 0x60e: goto L060e;
+    }
+    return ip;
+}
+
+IU a_0610() {    /// : ' ;
+    IU ip;
+L0610: A_CALL(0x610, a_0363);
+L0612: A_CALL(0x612, a_0409);
+L0614: if (!T) { POP(); goto L0618; } POP();
+L0617: A_EXIT(0x617);
+L0618: A_CALL(0x618, a_04ad);
+    return 0x61a;
+resume:
+    switch (ip) {
+    case 0x610: goto L0610;
+    case 0x612: goto L0612;
+    case 0x614: goto L0614;
+    case 0x617: goto L0617;
+    case 0x618: goto L0618;
+    }
+    return ip;
+}
+
+IU a_061a() {    /// : ] ;
+    IU ip;
+L061a: PUSH((DU)0x568);
+L061d: A_CALL(0x61d, a_0102);
+L061f: p_STORE();
+L0620: PUSH(0x0);
+L0622: p_DUP();
+L0623: A_CALL(0x623, a_0142);
+L0625: p_STORE();
+L0626: A_CALL(0x626, a_0146);
+L0628: p_STORE();
+L0629: A_EXIT(0x629);
+    return 0x62a;
+resume:
+    switch (ip) {
+    case 0x61a: goto L061a;
+    case 0x61d: goto L061d;
+    case 0x61f: goto L061f;
+    case 0x620: goto L0620;
+    case 0x622: goto L0622;
+    case 0x623: goto L0623;
+    case 0x625: goto L0625;
+    case 0x626: goto L0626;
+    case 0x628: goto L0628;
+    case 0x629: goto L0629;
+    }
+    return ip;
+}
+
+IU a_062a() {    /// : [COMPILE] ;
+    IU ip;
+L062a: A_CALL(0x62a, a_0610);
+L062c: A_CALL(0x62c, a_054b);
+L062e: A_EXIT(0x62e);
+    return 0x62f;
+resume:
+    switch (ip) {
+    case 0x62a: goto L062a;
+    case 0x62c: goto L062c;
+    case 0x62e: goto L062e;
+    }
+    return ip;
+}
+
+IU a_062f() {    /// : : ;
+    IU ip;
+L062f: A_CALL(0x62f, a_0363);
+L0631: A_CALL(0x631, a_05ec);
+L0633: A_CALL(0x633, a_061a);
+L0635: A_EXIT(0x635);
+    return 0x636;
+resume:
+    switch (ip) {
+    case 0x62f: goto L062f;
+    case 0x631: goto L0631;
+    case 0x633: goto L0633;
+    case 0x635: goto L0635;
+    }
+    return ip;
+}
+
+IU a_0636() {    /// : ; ;
+    IU ip;
+L0636: p_TAIL();
+L0637: A_CALL(0x637, a_055e);
+L063a: A_CALL(0x63a, a_04e6);
+L063c: A_CALL(0x63c, a_00fe);
+L063e: p_AT();
+L063f: A_CALL(0x63f, a_0136);
+L0641: p_AT();
+L0642: p_STORE();
+L0643: A_EXIT(0x643);
+    return 0x644;
+resume:
+    switch (ip) {
+    case 0x636: goto L0636;
+    case 0x637: goto L0637;
+    case 0x63a: goto L063a;
+    case 0x63c: goto L063c;
+    case 0x63e: goto L063e;
+    case 0x63f: goto L063f;
+    case 0x641: goto L0641;
+    case 0x642: goto L0642;
+    case 0x643: goto L0643;
+    }
+    return ip;
+}
+
+IU a_0644() {    /// : EXIT ;
+    IU ip;
+L0644: p_TAIL();
+L0645: A_CALL(0x645, a_055e);
+L0648: A_EXIT(0x648);
+    return 0x649;
+resume:
+    switch (ip) {
+    case 0x644: goto L0644;
+    case 0x645: goto L0645;
+    case 0x648: goto L0648;
+    }
+    return ip;
+}
+
+IU a_0649() {    /// : NOTAIL ;
+    IU ip;
+L0649: PUSH(0x0);
+L064b: A_CALL(0x64b, a_0142);
+L064d: p_STORE();
+L064e: A_EXIT(0x64e);
+    return 0x64f;
+resume:
+    switch (ip) {
+    case 0x649: goto L0649;
+    case 0x64b: goto L064b;
+    case 0x64d: goto L064d;
+    case 0x64e: goto L064e;
+    }
+    return ip;
+}
+
+IU a_064f() {    /// : RECURSE ;
+    IU ip;
+L064f: A_CALL(0x64f, a_00fe);
+L0651: p_AT();
+L0652: A_CALL(0x652, a_0379);
+L0654: A_CALL(0x654, a_054b);
+L0656: A_EXIT(0x656);
+    return 0x657;
+resume:
+    switch (ip) {
+    case 0x64f: goto L064f;
+    case 0x651: goto L0651;
+    case 0x652: goto L0652;
+    case 0x654: goto L0654;
+    case 0x656: goto L0656;
+    }
+    return ip;
+}
+
+IU a_0657() {    /// : (>NAME) ;
+    IU ip;
+L0657: p_AT();
+L0658: p_DUP();
+L0659: if (!T) { POP(); goto L066a; } POP();
+L065c: A_CALL(0x65c, a_00b1);
+L065e: A_CALL(0x65e, a_0379);
+L0660: p_EQ();
+L0661: if (!T) { POP(); goto L0665; } POP();
+L0664: A_EXIT(0x664);
+L0665: p_CELL();
+L0666: p_SUB();
+L0667: A_LOOP(0x657, L0657);
+L066a: A_EXIT(0x66a);
+    return 0x66b;
+resume:
+    switch (ip) {
+    case 0x657: goto L0657;
+    case 0x658: goto L0658;
+    case 0x659: goto L0659;
+    case 0x65c: goto L065c;
+    case 0x65e: goto L065e;
+    case 0x660: goto L0660;
+    case 0x661: goto L0661;
+    case 0x664: goto L0664;
+    case 0x665: goto L0665;
+    case 0x666: goto L0666;
+    case 0x667: goto L0667;
+    case 0x66a: goto L066a;
+    }
+    return ip;
+}
+
+IU a_066b() {    /// : >NAME ;
+    IU ip;
+L066b: A_CALL(0x66b, a_00fa);
+L066d: A_CALL(0x66d, a_0657);
+L066f: p_QDUP();
+L0670: if (!T) { POP(); goto L0676; } POP();
+L0673: p_SWAP();
+L0674: p_DROP();
+L0675: A_EXIT(0x675);
+L0676: A_CALL(0x676, a_013a);
+L0678: p_AT();
+L0679: p_DUP();
+L067a: if (!T) { POP(); goto L0690; } POP();
+L067d: p_DUP();
+L067e: p_TOR();
+L067f: A_CALL(0x67f, a_0657);
+L0681: p_QDUP();
+L0682: if (!T) { POP(); goto L068a; } POP();
+L0685: p_SWAP();
+L0686: p_DROP();
+L0687: p_RFROM();
+L0688: p_DROP();
+L0689: A_EXIT(0x689);
+L068a: p_RFROM();
+L068b: p_CELL();
+L068c: p_ADD();
+L068d: A_LOOP(0x678, L0678);
+L0690: p_SWAP();
+L0691: p_DROP();
+L0692: A_EXIT(0x692);
+    return 0x693;
+resume:
+    switch (ip) {
+    case 0x66b: goto L066b;
+    case 0x66d: goto L066d;
+    case 0x66f: goto L066f;
+    case 0x670: goto L0670;
+    case 0x673: goto L0673;
+    case 0x674: goto L0674;
+    case 0x675: goto L0675;
+    case 0x676: goto L0676;
+    case 0x678: goto L0678;
+    case 0x679: goto L0679;
+    case 0x67a: goto L067a;
+    case 0x67d: goto L067d;
+    case 0x67e: goto L067e;
+    case 0x67f: goto L067f;
+    case 0x681: goto L0681;
+    case 0x682: goto L0682;
+    case 0x685: goto L0685;
+    case 0x686: goto L0686;
+    case 0x687: goto L0687;
+    case 0x688: goto L0688;
+    case 0x689: goto L0689;
+    case 0x68a: goto L068a;
+    case 0x68b: goto L068b;
+    case 0x68c: goto L068c;
+    case 0x68d: goto L068d;
+    case 0x690: goto L0690;
+    case 0x691: goto L0691;
+    case 0x692: goto L0692;
+    }
+    return ip;
+}
+
+IU a_0693() {    /// : .ID ;
+    IU ip;
+L0693: p_QDUP();
+L0694: if (!T) { POP(); goto L069e; } POP();
+L0697: p_COUNT();
+L0698: PUSH(0x1f);
+L069a: p_AND();
+L069b: A_CALL(0x69b, a_029e);
+L069d: A_EXIT(0x69d);
+L069e: PUSH(0x3f);
+L06a0: p_TXSTO();
+L06a1: A_EXIT(0x6a1);
+    return 0x6a2;
+resume:
+    switch (ip) {
+    case 0x693: goto L0693;
+    case 0x694: goto L0694;
+    case 0x697: goto L0697;
+    case 0x698: goto L0698;
+    case 0x69a: goto L069a;
+    case 0x69b: goto L069b;
+    case 0x69d: goto L069d;
+    case 0x69e: goto L069e;
+    case 0x6a0: goto L06a0;
+    case 0x6a1: goto L06a1;
+    }
+    return ip;
+}
+
+IU a_06a2() {    /// : DUMP ;
+    IU ip;
+L06a2: A_CALL(0x6a2, a_00f2);
+L06a4: p_AT();
+L06a5: p_TOR();
+L06a6: A_CALL(0x6a6, a_020b);
+L06a8: PUSH(0x1f);
+L06aa: p_ADD();
+L06ab: PUSH(0x10);
+L06ad: p_DIV();
+L06ae: p_TOR();
+L06af: goto L06ec;
+L06b2: A_CALL(0x6b2, a_02ab);
+L06b4: PUSH(0x10);
+L06b6: A_CALL(0x6b6, a_00b1);
+L06b8: p_OVER();
+L06b9: PUSH(0x5);
+L06bb: A_CALL(0x6bb, a_02cf);
+L06bd: p_TOR();
+L06be: PUSH(0x3a);
+L06c0: p_TXSTO();
+L06c1: goto L06e1;
+L06c4: A_CALL(0x6c4, a_0288);
+L06c6: p_DUP();
+L06c7: p_CAT();
+L06c8: p_S2D();
+L06c9: PUSH(0x10);
+L06cb: A_CALL(0x6cb, a_01cf);
+L06cd: p_TOR();
+L06ce: PUSH(0x10);
+L06d0: A_CALL(0x6d0, a_01cf);
+L06d2: p_TXSTO();
+L06d3: p_RFROM();
+L06d4: p_TXSTO();
+L06d5: A_CALL(0x6d5, a_00b4);
+L06d7: p_ONEP();
+L06d8: p_RAT();
+L06d9: PUSH(0x8);
+L06db: p_EQ();
+L06dc: if (!T) { POP(); goto L06e1; } POP();
+L06df: A_CALL(0x6df, a_0288);
+L06e1: if (I-- > 0) { A_LOOP(0x6c4, L06c4); } RPOP();
+L06e4: p_TOR();
+L06e5: A_CALL(0x6e5, a_0288);
+L06e7: A_CALL(0x6e7, a_0288);
+L06e9: A_CALL(0x6e9, a_029e);
+L06eb: p_RFROM();
+L06ec: if (I-- > 0) { A_LOOP(0x6b2, L06b2); } RPOP();
+L06ef: p_DROP();
+L06f0: p_RFROM();
+L06f1: A_CALL(0x6f1, a_00f2);
+L06f3: p_STORE();
+L06f4: A_EXIT(0x6f4);
+    return 0x6f5;
+resume:
+    switch (ip) {
+    case 0x6a2: goto L06a2;
+    case 0x6a4: goto L06a4;
+    case 0x6a5: goto L06a5;
+    case 0x6a6: goto L06a6;
+    case 0x6a8: goto L06a8;
+    case 0x6aa: goto L06aa;
+    case 0x6ab: goto L06ab;
+    case 0x6ad: goto L06ad;
+    case 0x6ae: goto L06ae;
+    case 0x6af: goto L06af;
+    case 0x6b2: goto L06b2;
+    case 0x6b4: goto L06b4;
+    case 0x6b6: goto L06b6;
+    case 0x6b8: goto L06b8;
+    case 0x6b9: goto L06b9;
+    case 0x6bb: goto L06bb;
+    case 0x6bd: goto L06bd;
+    case 0x6be: goto L06be;
+    case 0x6c0: goto L06c0;
+    case 0x6c1: goto L06c1;
+    case 0x6c4: goto L06c4;
+    case 0x6c6: goto L06c6;
+    case 0x6c7: goto L06c7;
+    case 0x6c8: goto L06c8;
+    case 0x6c9: goto L06c9;
+    case 0x6cb: goto L06cb;
+    case 0x6cd: goto L06cd;
+    case 0x6ce: goto L06ce;
+    case 0x6d0: goto L06d0;
+    case 0x6d2: goto L06d2;
+    case 0x6d3: goto L06d3;
+    case 0x6d4: goto L06d4;
+    case 0x6d5: goto L06d5;
+    case 0x6d7: goto L06d7;
+    case 0x6d8: goto L06d8;
+    case 0x6d9: goto L06d9;
+    case 0x6db: goto L06db;
+    case 0x6dc: goto L06dc;
+    case 0x6df: goto L06df;
+    case 0x6e1: goto L06e1;
+    case 0x6e4: goto L06e4;
+    case 0x6e5: goto L06e5;
+    case 0x6e7: goto L06e7;
+    case 0x6e9: goto L06e9;
+    case 0x6eb: goto L06eb;
+    case 0x6ec: goto L06ec;
+    case 0x6ef: goto L06ef;
+    case 0x6f0: goto L06f0;
+    case 0x6f1: goto L06f1;
+    case 0x6f3: goto L06f3;
+    case 0x6f4: goto L06f4;
+    }
+    return ip;
+}
+
+IU a_06f5() {    /// : WORDS ;
+    IU ip;
+L06f5: A_CALL(0x6f5, a_02ab);
+L06f7: A_CALL(0x6f7, a_013e);
+L06f9: p_AT();
+L06fa: PUSH(0x0);
+L06fc: A_CALL(0x6fc, a_011a);
+L06fe: p_STORE();
+L06ff: p_AT();
+L0700: p_QDUP();
+L0701: if (!T) { POP(); goto L072a; } POP();
+L0704: p_DUP();
+L0705: p_COUNT();
+L0706: PUSH(0x1f);
+L0708: p_AND();
+L0709: p_DUP();
+L070a: p_ONEP();
+L070b: p_ONEP();
+L070c: A_CALL(0x70c, a_011a);
+L070e: p_PSTOR();
+L070f: A_CALL(0x70f, a_029e);
+L0711: A_CALL(0x711, a_0288);
+L0713: A_CALL(0x713, a_0288);
+L0715: p_CELL();
+L0716: p_SUB();
+L0717: A_CALL(0x717, a_011a);
+L0719: p_AT();
+L071a: PUSH(0x40);
+L071c: p_GT();
+L071d: if (!T) { POP(); goto L0727; } POP();
+L0720: A_CALL(0x720, a_02ab);
+L0722: PUSH(0x0);
+L0724: A_CALL(0x724, a_011a);
+L0726: p_STORE();
+L0727: A_LOOP(0x6ff, L06ff);
+L072a: A_EXIT(0x72a);
+    return 0x72b;
+resume:
+    switch (ip) {
+    case 0x6f5: goto L06f5;
+    case 0x6f7: goto L06f7;
+    case 0x6f9: goto L06f9;
+    case 0x6fa: goto L06fa;
+    case 0x6fc: goto L06fc;
+    case 0x6fe: goto L06fe;
+    case 0x6ff: goto L06ff;
+    case 0x700: goto L0700;
+    case 0x701: goto L0701;
+    case 0x704: goto L0704;
+    case 0x705: goto L0705;
+    case 0x706: goto L0706;
+    case 0x708: goto L0708;
+    case 0x709: goto L0709;
+    case 0x70a: goto L070a;
+    case 0x70b: goto L070b;
+    case 0x70c: goto L070c;
+    case 0x70e: goto L070e;
+    case 0x70f: goto L070f;
+    case 0x711: goto L0711;
+    case 0x713: goto L0713;
+    case 0x715: goto L0715;
+    case 0x716: goto L0716;
+    case 0x717: goto L0717;
+    case 0x719: goto L0719;
+    case 0x71a: goto L071a;
+    case 0x71c: goto L071c;
+    case 0x71d: goto L071d;
+    case 0x720: goto L0720;
+    case 0x722: goto L0722;
+    case 0x724: goto L0724;
+    case 0x726: goto L0726;
+    case 0x727: goto L0727;
+    case 0x72a: goto L072a;
+    }
+    return ip;
+}
+
+IU a_072b() {    /// : FORGET ;
+    IU ip;
+L072b: A_CALL(0x72b, a_0363);
+L072d: A_CALL(0x72d, a_0136);
+L072f: p_AT();
+L0730: A_CALL(0x730, a_03b2);
+L0732: p_QDUP();
+L0733: if (!T) { POP(); goto L0763; } POP();
+L0736: p_DUP();
+L0737: p_CAT();
+L0738: PUSH(0x20);
+L073a: p_AND();
+L073b: if (!T) { POP(); goto L0750; } POP();
+L073e: p_OVER();
+L073f: A_CALL(0x73f, a_00f6);
+L0741: p_STORE();
+L0742: p_DUP();
+L0743: p_COUNT();
+L0744: PUSH(0x1f);
+L0746: p_AND();
+L0747: p_ADD();
+L0748: p_CELL();
+L0749: p_ADD();
+L074a: A_CALL(0x74a, a_012a);
+L074c: p_STORE();
+L074d: goto L0756;
+L0750: p_DUP();
+L0751: p_CELL();
+L0752: p_SUB();
+L0753: A_CALL(0x753, a_00f6);
+L0755: p_STORE();
+L0756: p_CELL();
+L0757: p_SUB();
+L0758: p_AT();
+L0759: p_DUP();
+L075a: A_CALL(0x75a, a_0136);
+L075c: p_AT();
+L075d: p_STORE();
+L075e: A_CALL(0x75e, a_00fe);
+L0760: p_STORE();
+L0761: p_DROP();
+L0762: A_EXIT(0x762);
+L0763: A_CALL(0x763, a_04ad);
+    return 0x765;
+resume:
+    switch (ip) {
+    case 0x72b: goto L072b;
+    case 0x72d: goto L072d;
+    case 0x72f: goto L072f;
+    case 0x730: goto L0730;
+    case 0x732: goto L0732;
+    case 0x733: goto L0733;
+    case 0x736: goto L0736;
+    case 0x737: goto L0737;
+    case 0x738: goto L0738;
+    case 0x73a: goto L073a;
+    case 0x73b: goto L073b;
+    case 0x73e: goto L073e;
+    case 0x73f: goto L073f;
+    case 0x741: goto L0741;
+    case 0x742: goto L0742;
+    case 0x743: goto L0743;
+    case 0x744: goto L0744;
+    case 0x746: goto L0746;
+    case 0x747: goto L0747;
+    case 0x748: goto L0748;
+    case 0x749: goto L0749;
+    case 0x74a: goto L074a;
+    case 0x74c: goto L074c;
+    case 0x74d: goto L074d;
+    case 0x750: goto L0750;
+    case 0x751: goto L0751;
+    case 0x752: goto L0752;
+    case 0x753: goto L0753;
+    case 0x755: goto L0755;
+    case 0x756: goto L0756;
+    case 0x757: goto L0757;
+    case 0x758: goto L0758;
+    case 0x759: goto L0759;
+    case 0x75a: goto L075a;
+    case 0x75c: goto L075c;
+    case 0x75d: goto L075d;
+    case 0x75e: goto L075e;
+    case 0x760: goto L0760;
+    case 0x761: goto L0761;
+    case 0x762: goto L0762;
+    case 0x763: goto L0763;
+    }
+    return ip;
+}
+
+IU a_0765() {    /// : HEADERLESS ;
+    IU ip;
+L0765: PUSH((DU)0xffff);
+L0768: A_CALL(0x768, a_012e);
+L076a: p_STORE();
+L076b: A_EXIT(0x76b);
+    return 0x76c;
+resume:
+    switch (ip) {
+    case 0x765: goto L0765;
+    case 0x768: goto L0768;
+    case 0x76a: goto L076a;
+    case 0x76b: goto L076b;
+    }
+    return ip;
+}
+
+IU a_076c() {    /// : HEADERS ;
+    IU ip;
+L076c: PUSH(0x0);
+L076e: A_CALL(0x76e, a_012e);
+L0770: p_STORE();
+L0771: A_EXIT(0x771);
+    return 0x772;
+resume:
+    switch (ip) {
+    case 0x76c: goto L076c;
+    case 0x76e: goto L076e;
+    case 0x770: goto L0770;
+    case 0x771: goto L0771;
+    }
+    return ip;
+}
+
+IU a_0772() {    /// : PRUNE ;
+       p_PRUNE();
+       A_EXIT(0x773);
+    return 0x774;
+}
+
+IU a_0774() {    /// : SNAPSHOT ;
+       p_SNAP();
+       A_EXIT(0x775);
+    return 0x776;
+}
+
+IU a_0776() {    /// : RESTORE ;
+       p_RESTO();
+       A_EXIT(0x777);
+    return 0x778;
+}
+
+IU a_0778() {    /// : .ADDR ;
+    IU ip;
+L0778: A_CALL(0x778, a_02ab);
+L077a: p_DUP();
+L077b: A_CALL(0x77b, a_02e4);
+L077d: PUSH(0x3a);
+L077f: p_TXSTO();
+L0780: A_EXIT(0x780);
+    return 0x781;
+resume:
+    switch (ip) {
+    case 0x778: goto L0778;
+    case 0x77a: goto L077a;
+    case 0x77b: goto L077b;
+    case 0x77d: goto L077d;
+    case 0x77f: goto L077f;
+    case 0x780: goto L0780;
+    }
+    return ip;
+}
+
+IU a_0781() {    /// : .OP ;
+    IU ip;
+L0781: p_DUP();
+L0782: PUSH(0x80);
+L0784: p_AND();
+L0785: if (!T) { POP(); goto L07b8; } POP();
+L0788: p_DROP();
+L0789: p_DUP();
+L078a: p_AT();
+L078b: PUSH((DU)0x7fff);
+L078e: p_AND();
+L078f: p_DUP();
+L0790: A_CALL(0x790, a_0288);
+L0792: A_CALL(0x792, a_066b);
+L0794: A_CALL(0x794, a_0693);
+L0796: p_DUP();
+L0797: PUSH((DU)0x2bf);
+L079a: p_EQ();
+L079b: p_SWAP();
+L079c: PUSH((DU)0x2bc);
+L079f: p_EQ();
+L07a0: p_OR();
+L07a1: if (!T) { POP(); goto L07b5; } POP();
+L07a4: A_CALL(0x7a4, a_0288);
+L07a6: p_CELL();
+L07a7: p_ADD();
+L07a8: p_COUNT();
+L07a9: A_CALL(0x7a9, a_00b1);
+L07ab: A_CALL(0x7ab, a_029e);
+L07ad: PUSH(0x22);
+L07af: p_TXSTO();
+L07b0: p_ADD();
+L07b1: A_EXIT(0x7b1);
+L07b2: goto L07b8;
+L07b5: p_CELL();
+L07b6: p_ADD();
+L07b7: A_EXIT(0x7b7);
+L07b8: p_DUP();
+L07b9: PUSH(0x6);
+L07bb: p_EQ();
+L07bc: if (!T) { POP(); goto L07c7; } POP();
+L07bf: p_DROP();
+L07c0: p_ONEP();
+L07c1: p_DUP();
+L07c2: p_CAT();
+L07c3: A_CALL(0x7c3, a_02e4);
+L07c5: p_ONEP();
+L07c6: A_EXIT(0x7c6);
+L07c7: p_DUP();
+L07c8: PUSH(0x7);
+L07ca: p_EQ();
+L07cb: if (!T) { POP(); goto L07d7; } POP();
+L07ce: p_DROP();
+L07cf: p_ONEP();
+L07d0: p_DUP();
+L07d1: p_AT();
+L07d2: A_CALL(0x7d2, a_02e4);
+L07d4: p_CELL();
+L07d5: p_ADD();
+L07d6: A_EXIT(0x7d6);
+L07d7: p_DUP();
+L07d8: PUSH(0x8);
+L07da: p_EQ();
+L07db: if (!T) { POP(); goto L07ea; } POP();
+L07de: p_DROP();
+L07df: p_ONEP();
+L07e0: p_ONEP();
+L07e1: p_DUP();
+L07e2: p_AT();
+L07e3: A_CALL(0x7e3, a_02e4);
+L07e5: PUSH(0x76);
+L07e7: p_TXSTO();
+L07e8: p_ONEM();
+L07e9: A_EXIT(0x7e9);
+L07ea: p_DUP();
+L07eb: PUSH(0xd);
+L07ed: p_EQ();
+L07ee: if (!T) { POP(); goto L07ff; } POP();
+L07f1: p_DROP();
+L07f2: p_ONEP();
+L07f3: p_DUP();
+L07f4: p_AT();
+L07f5: A_CALL(0x7f5, a_02e4);
+L07f7: PUSH(0x6a);
+L07f9: p_TXSTO();
+L07fa: p_CELL();
+L07fb: p_ADD();
+L07fc: A_CALL(0x7fc, a_0778);
+L07fe: A_EXIT(0x7fe);
+L07ff: p_DUP();
+L0800: PUSH(0xc);
+L0802: p_EQ();
+L0803: if (!T) { POP(); goto L0814; } POP();
+L0806: p_DROP();
+L0807: p_ONEP();
+L0808: p_DUP();
+L0809: p_AT();
+L080a: A_CALL(0x80a, a_02e4);
+L080c: PUSH(0x3f);
+L080e: p_TXSTO();
+L080f: p_CELL();
+L0810: p_ADD();
+L0811: A_CALL(0x811, a_0778);
+L0813: A_EXIT(0x813);
+L0814: p_DUP();
+L0815: PUSH(0xb);
+L0817: p_EQ();
+L0818: if (!T) { POP(); goto L0829; } POP();
+L081b: p_DROP();
+L081c: p_ONEP();
+L081d: p_DUP();
+L081e: p_AT();
+L081f: A_CALL(0x81f, a_02e4);
+L0821: PUSH(0x6e);
+L0823: p_TXSTO();
+L0824: p_CELL();
+L0825: p_ADD();
+L0826: A_CALL(0x826, a_0778);
+L0828: A_EXIT(0x828);
+L0829: p_DUP();
+L082a: PUSH(0x76);
+L082c: PUSH(0x79);
+L082e: p_WITHIN();
+L082f: if (!T) { POP(); goto L0840; } POP();
+L0832: p_DROP();
+L0833: p_ONEP();
+L0834: p_DUP();
+L0835: p_AT();
+L0836: A_CALL(0x836, a_02e4);
+L0838: PUSH(0x6c);
+L083a: p_TXSTO();
+L083b: p_CELL();
+L083c: p_ADD();
+L083d: A_CALL(0x83d, a_0778);
+L083f: A_EXIT(0x83f);
+L0840: p_DUP();
+L0841: PUSH(0xa);
+L0843: p_EQ();
+L0844: if (!T) { POP(); goto L0860; } POP();
+L0847: p_DROP();
+L0848: p_ONEP();
+L0849: p_DUP();
+L084a: p_CAT();
+L084b: p_SWAP();
+L084c: p_DUP();
+L084d: p_ONEP();
+L084e: p_AT();
+L084f: A_CALL(0x84f, a_02e4);
+L0851: PUSH(0x2a);
+L0853: p_TXSTO();
+L0854: p_ADD();
+L0855: p_ONEP();
+L0856: p_AT();
+L0857: p_DUP();
+L0858: A_CALL(0x858, a_02e4);
+L085a: PUSH(0x6a);
+L085c: p_TXSTO();
+L085d: A_CALL(0x85d, a_0778);
+L085f: A_EXIT(0x85f);
+L0860: A_CALL(0x860, a_0288);
+L0862: A_CALL(0x862, a_00fa);
+L0864: p_AT();
+L0865: p_DUP();
+L0866: if (!T) { POP(); goto L0889; } POP();
+L0869: p_DUP();
+L086a: A_CALL(0x86a, a_0379);
+L086c: p_DUP();
+L086d: p_ONEP();
+L086e: p_CAT();
+L086f: PUSH(0x1);
+L0871: p_EQ();
+L0872: if (!T) { POP(); goto L0883; } POP();
+L0875: p_CAT();
+L0876: p_TOR();
+L0877: p_OVER();
+L0878: p_RFROM();
+L0879: p_EQ();
+L087a: if (!T) { POP(); goto L0882; } POP();
+L087d: A_CALL(0x87d, a_0693);
+L087f: p_DROP();
+L0880: p_ONEP();
+L0881: A_EXIT(0x881);
+L0882: p_DUP();
+L0883: p_DROP();
+L0884: p_CELL();
+L0885: p_SUB();
+L0886: A_LOOP(0x864, L0864);
+L0889: A_CALL(0x889, a_02e4);
+L088b: PUSH(0x3f);
+L088d: p_TXSTO();
+L088e: p_DROP();
+L088f: p_ONEP();
+L0890: A_EXIT(0x890);
+    return 0x891;
+resume:
+    switch (ip) {
+    case 0x781: goto L0781;
+    case 0x782: goto L0782;
+    case 0x784: goto L0784;
+    case 0x785: goto L0785;
+    case 0x788: goto L0788;
+    case 0x789: goto L0789;
+    case 0x78a: goto L078a;
+    case 0x78b: goto L078b;
+    case 0x78e: goto L078e;
+    case 0x78f: goto L078f;
+    case 0x790: goto L0790;
+    case 0x792: goto L0792;
+    case 0x794: goto L0794;
+    case 0x796: goto L0796;
+    case 0x797: goto L0797;
+    case 0x79a: goto L079a;
+    case 0x79b: goto L079b;
+    case 0x79c: goto L079c;
+    case 0x79f: goto L079f;
+    case 0x7a0: goto L07a0;
+    case 0x7a1: goto L07a1;
+    case 0x7a4: goto L07a4;
+    case 0x7a6: goto L07a6;
+    case 0x7a7: goto L07a7;
+    case 0x7a8: goto L07a8;
+    case 0x7a9: goto L07a9;
+    case 0x7ab: goto L07ab;
+    case 0x7ad: goto L07ad;
+    case 0x7af: goto L07af;
+    case 0x7b0: goto L07b0;
+    case 0x7b1: goto L07b1;
+    case 0x7b2: goto L07b2;
+    case 0x7b5: goto L07b5;
+    case 0x7b6: goto L07b6;
+    case 0x7b7: goto L07b7;
+    case 0x7b8: goto L07b8;
+    case 0x7b9: goto L07b9;
+    case 0x7bb: goto L07bb;
+    case 0x7bc: goto L07bc;
+    case 0x7bf: goto L07bf;
+    case 0x7c0: goto L07c0;
+    case 0x7c1: goto L07c1;
+    case 0x7c2: goto L07c2;
+    case 0x7c3: goto L07c3;
+    case 0x7c5: goto L07c5;
+    case 0x7c6: goto L07c6;
+    case 0x7c7: goto L07c7;
+    case 0x7c8: goto L07c8;
+    case 0x7ca: goto L07ca;
+    case 0x7cb: goto L07cb;
+    case 0x7ce: goto L07ce;
+    case 0x7cf: goto L07cf;
+    case 0x7d0: goto L07d0;
+    case 0x7d1: goto L07d1;
+    case 0x7d2: goto L07d2;
+    case 0x7d4: goto L07d4;
+    case 0x7d5: goto L07d5;
+    case 0x7d6: goto L07d6;
+    case 0x7d7: goto L07d7;
+    case 0x7d8: goto L07d8;
+    case 0x7da: goto L07da;
+    case 0x7db: goto L07db;
+    case 0x7de: goto L07de;
+    case 0x7df: goto L07df;
+    case 0x7e0: goto L07e0;
+    case 0x7e1: goto L07e1;
+    case 0x7e2: goto L07e2;
+    case 0x7e3: goto L07e3;
+    case 0x7e5: goto L07e5;
+    case 0x7e7: goto L07e7;
+    case 0x7e8: goto L07e8;
+    case 0x7e9: goto L07e9;
+    case 0x7ea: goto L07ea;
+    case 0x7eb: goto L07eb;
+    case 0x7ed: goto L07ed;
+    case 0x7ee: goto L07ee;
+    case 0x7f1: goto L07f1;
+    case 0x7f2: goto L07f2;
+    case 0x7f3: goto L07f3;
+    case 0x7f4: goto L07f4;
+    case 0x7f5: goto L07f5;
+    case 0x7f7: goto L07f7;
+    case 0x7f9: goto L07f9;
+    case 0x7fa: goto L07fa;
+    case 0x7fb: goto L07fb;
+    case 0x7fc: goto L07fc;
+    case 0x7fe: goto L07fe;
+    case 0x7ff: goto L07ff;
+    case 0x800: goto L0800;
+    case 0x802: goto L0802;
+    case 0x803: goto L0803;
+    case 0x806: goto L0806;
+    case 0x807: goto L0807;
+    case 0x808: goto L0808;
+    case 0x809: goto L0809;
+    case 0x80a: goto L080a;
+    case 0x80c: goto L080c;
+    case 0x80e: goto L080e;
+    case 0x80f: goto L080f;
+    case 0x810: goto L0810;
+    case 0x811: goto L0811;
+    case 0x813: goto L0813;
+    case 0x814: goto L0814;
+    case 0x815: goto L0815;
+    case 0x817: goto L0817;
+    case 0x818: goto L0818;
+    case 0x81b: goto L081b;
+    case 0x81c: goto L081c;
+    case 0x81d: goto L081d;
+    case 0x81e: goto L081e;
+    case 0x81f: goto L081f;
+    case 0x821: goto L0821;
+    case 0x823: goto L0823;
+    case 0x824: goto L0824;
+    case 0x825: goto L0825;
+    case 0x826: goto L0826;
+    case 0x828: goto L0828;
+    case 0x829: goto L0829;
+    case 0x82a: goto L082a;
+    case 0x82c: goto L082c;
+    case 0x82e: goto L082e;
+    case 0x82f: goto L082f;
+    case 0x832: goto L0832;
+    case 0x833: goto L0833;
+    case 0x834: goto L0834;
+    case 0x835: goto L0835;
+    case 0x836: goto L0836;
+    case 0x838: goto L0838;
+    case 0x83a: goto L083a;
+    case 0x83b: goto L083b;
+    case 0x83c: goto L083c;
+    case 0x83d: goto L083d;
+    case 0x83f: goto L083f;
+    case 0x840: goto L0840;
+    case 0x841: goto L0841;
+    case 0x843: goto L0843;
+    case 0x844: goto L0844;
+    case 0x847: goto L0847;
+    case 0x848: goto L0848;
+    case 0x849: goto L0849;
+    case 0x84a: goto L084a;
+    case 0x84b: goto L084b;
+    case 0x84c: goto L084c;
+    case 0x84d: goto L084d;
+    case 0x84e: goto L084e;
+    case 0x84f: goto L084f;
+    case 0x851: goto L0851;
+    case 0x853: goto L0853;
+    case 0x854: goto L0854;
+    case 0x855: goto L0855;
+    case 0x856: goto L0856;
+    case 0x857: goto L0857;
+    case 0x858: goto L0858;
+    case 0x85a: goto L085a;
+    case 0x85c: goto L085c;
+    case 0x85d: goto L085d;
+    case 0x85f: goto L085f;
+    case 0x860: goto L0860;
+    case 0x862: goto L0862;
+    case 0x864: goto L0864;
+    case 0x865: goto L0865;
+    case 0x866: goto L0866;
+    case 0x869: goto L0869;
+    case 0x86a: goto L086a;
+    case 0x86c: goto L086c;
+    case 0x86d: goto L086d;
+    case 0x86e: goto L086e;
+    case 0x86f: goto L086f;
+    case 0x871: goto L0871;
+    case 0x872: goto L0872;
+    case 0x875: goto L0875;
+    case 0x876: goto L0876;
+    case 0x877: goto L0877;
+    case 0x878: goto L0878;
+    case 0x879: goto L0879;
+    case 0x87a: goto L087a;
+    case 0x87d: goto L087d;
+    case 0x87f: goto L087f;
+    case 0x880: goto L0880;
+    case 0x881: goto L0881;
+    case 0x882: goto L0882;
+    case 0x883: goto L0883;
+    case 0x884: goto L0884;
+    case 0x885: goto L0885;
+    case 0x886: goto L0886;
+    case 0x889: goto L0889;
+    case 0x88b: goto L088b;
+    case 0x88d: goto L088d;
+    case 0x88e: goto L088e;
+    case 0x88f: goto L088f;
+    case 0x890: goto L0890;
+    }
+    return ip;
+}
+
+IU a_0891() {    /// : SEE ;
+    IU ip;
+L0891: A_CALL(0x891, a_0610);
+L0893: A_CALL(0x893, a_0778);
+L0895: p_DUP();
+L0896: p_CAT();
+L0897: p_DUP();
+L0898: PUSH(0x1);
+L089a: p_EQ();
+L089b: p_INV();
+L089c: if (!T) { POP(); goto L08a4; } POP();
+L089f: A_CALL(0x89f, a_0781);
+L08a1: A_LOOP(0x895, L0895);
+L08a4: A_CALL(0x8a4, a_00b4);
+L08a6: A_CALL(0x8a6, a_0288);
+L08a8: PUSH(0x3b);
+L08aa: p_TXSTO();
+L08ab: A_EXIT(0x8ab);
+    return 0x8ac;
+resume:
+    switch (ip) {
+    case 0x891: goto L0891;
+    case 0x893: goto L0893;
+    case 0x895: goto L0895;
+    case 0x896: goto L0896;
+    case 0x897: goto L0897;
+    case 0x898: goto L0898;
+    case 0x89a: goto L089a;
+    case 0x89b: goto L089b;
+    case 0x89c: goto L089c;
+    case 0x89f: goto L089f;
+    case 0x8a1: goto L08a1;
+    case 0x8a4: goto L08a4;
+    case 0x8a6: goto L08a6;
+    case 0x8a8: goto L08a8;
+    case 0x8aa: goto L08aa;
+    case 0x8ab: goto L08ab;
+    }
+    return ip;
+}
+
+IU a_08ac() {    /// : AHEAD ;
+    IU ip;
+L08ac: A_CALL(0x8ac, a_055e);
+L08af: A_CALL(0x8af, a_0162);
+L08b1: PUSH(0x0);
+L08b3: A_CALL(0x8b3, a_0534);
+L08b5: A_EXIT(0x8b5);
+    return 0x8b6;
+resume:
+    switch (ip) {
+    case 0x8ac: goto L08ac;
+    case 0x8af: goto L08af;
+    case 0x8b1: goto L08b1;
+    case 0x8b3: goto L08b3;
+    case 0x8b5: goto L08b5;
+    }
+    return ip;
+}
+
+IU a_08b6() {    /// : AGAIN ;
+    IU ip;
+L08b6: A_CALL(0x8b6, a_055e);
+L08b9: A_CALL(0x8b9, a_0534);
+L08bb: A_EXIT(0x8bb);
+    return 0x8bc;
+resume:
+    switch (ip) {
+    case 0x8b6: goto L08b6;
+    case 0x8b9: goto L08b9;
+    case 0x8bb: goto L08bb;
+    }
+    return ip;
+}
+
+IU a_08bc() {    /// : BEGIN ;
+    IU ip;
+L08bc: A_CALL(0x8bc, a_0162);
+L08be: PUSH(0x0);
+L08c0: A_CALL(0x8c0, a_0146);
+L08c2: p_STORE();
+L08c3: A_EXIT(0x8c3);
+    return 0x8c4;
+resume:
+    switch (ip) {
+    case 0x8bc: goto L08bc;
+    case 0x8be: goto L08be;
+    case 0x8c0: goto L08c0;
+    case 0x8c2: goto L08c2;
+    case 0x8c3: goto L08c3;
+    }
+    return ip;
+}
+
+IU a_08c4() {    /// : UNTIL ;
+    IU ip;
+L08c4: A_CALL(0x8c4, a_055e);
+L08c7: A_CALL(0x8c7, a_0534);
+L08c9: A_EXIT(0x8c9);
+    return 0x8ca;
+resume:
+    switch (ip) {
+    case 0x8c4: goto L08c4;
+    case 0x8c7: goto L08c7;
+    case 0x8c9: goto L08c9;
+    }
+    return ip;
+}
+
+IU a_08ca() {    /// : IF ;
+    IU ip;
+L08ca: A_CALL(0x8ca, a_055e);
+L08cd: A_CALL(0x8cd, a_0162);
+L08cf: PUSH(0x0);
+L08d1: A_CALL(0x8d1, a_0534);
+L08d3: A_EXIT(0x8d3);
+    return 0x8d4;
+resume:
+    switch (ip) {
+    case 0x8ca: goto L08ca;
+    case 0x8cd: goto L08cd;
+    case 0x8cf: goto L08cf;
+    case 0x8d1: goto L08d1;
+    case 0x8d3: goto L08d3;
+    }
+    return ip;
+}
+
+IU a_08d4() {    /// : THEN ;
+    IU ip;
+L08d4: A_CALL(0x8d4, a_0162);
+L08d6: p_SWAP();
+L08d7: p_STORE();
+L08d8: PUSH(0x0);
+L08da: p_DUP();
+L08db: A_CALL(0x8db, a_0142);
+L08dd: p_STORE();
+L08de: A_CALL(0x8de, a_0146);
+L08e0: p_STORE();
+L08e1: A_EXIT(0x8e1);
+    return 0x8e2;
+resume:
+    switch (ip) {
+    case 0x8d4: goto L08d4;
+    case 0x8d6: goto L08d6;
+    case 0x8d7: goto L08d7;
+    case 0x8d8: goto L08d8;
+    case 0x8da: goto L08da;
+    case 0x8db: goto L08db;
+    case 0x8dd: goto L08dd;
+    case 0x8de: goto L08de;
+    case 0x8e0: goto L08e0;
+    case 0x8e1: goto L08e1;
+    }
+    return ip;
+}
+
+IU a_08e2() {    /// : ELSE ;
+    IU ip;
+L08e2: A_CALL(0x8e2, a_08ac);
+L08e4: p_SWAP();
+L08e5: A_CALL(0x8e5, a_08d4);
+L08e7: A_EXIT(0x8e7);
+    return 0x8e8;
+resume:
+    switch (ip) {
+    case 0x8e2: goto L08e2;
+    case 0x8e4: goto L08e4;
+    case 0x8e5: goto L08e5;
+    case 0x8e7: goto L08e7;
+    }
+    return ip;
+}
+
+IU a_08e8() {    /// : WHILE ;
+    IU ip;
+L08e8: A_CALL(0x8e8, a_08ca);
+L08ea: p_SWAP();
+L08eb: A_EXIT(0x8eb);
+    return 0x8ec;
+resume:
+    switch (ip) {
+    case 0x8e8: goto L08e8;
+    case 0x8ea: goto L08ea;
+    case 0x8eb: goto L08eb;
+    }
+    return ip;
+}
+
+IU a_08ec() {    /// : WHEN ;
+    IU ip;
+L08ec: A_CALL(0x8ec, a_08ca);
+L08ee: p_OVER();
+L08ef: A_EXIT(0x8ef);
+    return 0x8f0;
+resume:
+    switch (ip) {
+    case 0x8ec: goto L08ec;
+    case 0x8ee: goto L08ee;
+    case 0x8ef: goto L08ef;
+    }
+    return ip;
+}
+
+IU a_08f0() {    /// : REPEAT ;
+    IU ip;
+L08f0: A_CALL(0x8f0, a_08b6);
+L08f2: A_CALL(0x8f2, a_08d4);
+L08f4: A_EXIT(0x8f4);
+    return 0x8f5;
+resume:
+    switch (ip) {
+    case 0x8f0: goto L08f0;
+    case 0x8f2: goto L08f2;
+    case 0x8f4: goto L08f4;
+    }
+    return ip;
+}
+
+IU a_08f5() {    /// : FOR ;
+    IU ip;
+L08f5: A_CALL(0x8f5, a_055e);
+L08f8: A_CALL(0x8f8, a_0162);
+L08fa: A_EXIT(0x8fa);
+    return 0x8fb;
+resume:
+    switch (ip) {
+    case 0x8f5: goto L08f5;
+    case 0x8f8: goto L08f8;
+    case 0x8fa: goto L08fa;
+    }
+    return ip;
+}
+
+IU a_08fb() {    /// : AFT ;
+    IU ip;
+L08fb: p_DROP();
+L08fc: A_CALL(0x8fc, a_08ac);
+L08fe: A_CALL(0x8fe, a_0162);
+L0900: p_SWAP();
+L0901: A_EXIT(0x901);
+    return 0x902;
+resume:
+    switch (ip) {
+    case 0x8fb: goto L08fb;
+    case 0x8fc: goto L08fc;
+    case 0x8fe: goto L08fe;
+    case 0x900: goto L0900;
+    case 0x901: goto L0901;
+    }
+    return ip;
+}
+
+IU a_0902() {    /// : NEXT ;
+    IU ip;
+L0902: A_CALL(0x902, a_055e);
+L0905: A_CALL(0x905, a_0534);
+L0907: A_EXIT(0x907);
+    return 0x908;
+resume:
+    switch (ip) {
+    case 0x902: goto L0902;
+    case 0x905: goto L0905;
+    case 0x907: goto L0907;
+    }
+    return ip;
+}
+
+IU a_0908() {    /// : DO ;
+    IU ip;
+L0908: A_CALL(0x908, a_055e);
+L090b: A_CALL(0x90b, a_0162);
+L090d: PUSH(0x0);
+L090f: A_CALL(0x90f, a_0534);
+L0911: A_CALL(0x911, a_0162);
+L0913: A_EXIT(0x913);
+    return 0x914;
+resume:
+    switch (ip) {
+    case 0x908: goto L0908;
+    case 0x90b: goto L090b;
+    case 0x90d: goto L090d;
+    case 0x90f: goto L090f;
+    case 0x911: goto L0911;
+    case 0x913: goto L0913;
+    }
+    return ip;
+}
+
+IU a_0914() {    /// : LOOP ;
+    IU ip;
+L0914: A_CALL(0x914, a_055e);
+L0917: A_CALL(0x917, a_0534);
+L0919: A_CALL(0x919, a_08d4);
+L091b: A_EXIT(0x91b);
+    return 0x91c;
+resume:
+    switch (ip) {
+    case 0x914: goto L0914;
+    case 0x917: goto L0917;
+    case 0x919: goto L0919;
+    case 0x91b: goto L091b;
+    }
+    return ip;
+}
+
+IU a_091c() {    /// : +LOOP ;
+    IU ip;
+L091c: A_CALL(0x91c, a_055e);
+L091f: A_CALL(0x91f, a_0534);
+L0921: A_CALL(0x921, a_08d4);
+L0923: A_EXIT(0x923);
+    return 0x924;
+resume:
+    switch (ip) {
+    case 0x91c: goto L091c;
+    case 0x91f: goto L091f;
+    case 0x921: goto L0921;
+    case 0x923: goto L0923;
+    }
+    return ip;
+}
+
+IU a_0924() {    /// : $," ;
+    IU ip;
+L0924: PUSH(0x22);
+L0926: A_CALL(0x926, a_0370);
+L0928: p_COUNT();
+L0929: p_ADD();
+L092a: A_CALL(0x92a, a_00f6);
+L092c: p_STORE();
+L092d: A_EXIT(0x92d);
+    return 0x92e;
+resume:
+    switch (ip) {
+    case 0x924: goto L0924;
+    case 0x926: goto L0926;
+    case 0x928: goto L0928;
+    case 0x929: goto L0929;
+    case 0x92a: goto L092a;
+    case 0x92c: goto L092c;
+    case 0x92d: goto L092d;
+    }
+    return ip;
+}
+
+IU a_092e() {    /// : $" ;
+    IU ip;
+L092e: PUSH((DU)0x82bc);
+L0931: A_CALL(0x931, a_0162);
+L0933: p_STORE();
+L0934: A_CALL(0x934, a_0924);
+L0936: A_EXIT(0x936);
+    return 0x937;
+resume:
+    switch (ip) {
+    case 0x92e: goto L092e;
+    case 0x931: goto L0931;
+    case 0x933: goto L0933;
+    case 0x934: goto L0934;
+    case 0x936: goto L0936;
+    }
+    return ip;
+}
+
+IU a_0937() {    /// : ." ;
+    IU ip;
+L0937: PUSH((DU)0x82bf);
+L093a: A_CALL(0x93a, a_0162);
+L093c: p_STORE();
+L093d: A_CALL(0x93d, a_0924);
+L093f: A_EXIT(0x93f);
+    return 0x940;
+resume:
+    switch (ip) {
+    case 0x937: goto L0937;
+    case 0x93a: goto L093a;
+    case 0x93c: goto L093c;
+    case 0x93d: goto L093d;
+    case 0x93f: goto L093f;
+    }
+    return ip;
+}
+
+IU a_0940() {    /// : CODE ;
+    IU ip;
+L0940: A_CALL(0x940, a_0363);
+L0942: A_CALL(0x942, a_05ec);
+L0944: A_CALL(0x944, a_00fe);
+L0946: p_AT();
+L0947: A_CALL(0x947, a_0136);
+L0949: p_AT();
+L094a: p_STORE();
+L094b: A_EXIT(0x94b);
+    return 0x94c;
+resume:
+    switch (ip) {
+    case 0x940: goto L0940;
+    case 0x942: goto L0942;
+    case 0x944: goto L0944;
+    case 0x946: goto L0946;
+    case 0x947: goto L0947;
+    case 0x949: goto L0949;
+    case 0x94a: goto L094a;
+    case 0x94b: goto L094b;
+    }
+    return ip;
+}
+
+IU a_094c() {    /// : CREATE ;
+    IU ip;
+L094c: A_CALL(0x94c, a_0940);
+L094e: A_CALL(0x94e, a_055e);
+L0951: A_CALL(0x951, a_055e);
+L0954: A_EXIT(0x954);
+    return 0x955;
+resume:
+    switch (ip) {
+    case 0x94c: goto L094c;
+    case 0x94e: goto L094e;
+    case 0x951: goto L0951;
+    case 0x954: goto L0954;
+    }
+    return ip;
+}
+
+IU a_0955() {    /// : DOES> ;
+    IU ip;
+L0955: p_RFROM();
+L0956: A_CALL(0x956, a_0162);
+L0958: A_CALL(0x958, a_00fe);
+L095a: p_AT();
+L095b: A_CALL(0x95b, a_0379);
+L095d: p_DUP();
+L095e: p_TOR();
+L095f: p_SUB();
+L0960: p_ONEM();
+L0961: PUSH(0xa);
+L0963: p_RAT();
+L0964: p_CSTOR();
+L0965: p_RFROM();
+L0966: p_ONEP();
+L0967: p_CSTOR();
+L0968: A_CALL(0x968, a_055e);
+L096b: A_CALL(0x96b, a_0534);
+L096d: A_CALL(0x96d, a_055e);
+L0970: A_EXIT(0x970);
+    return 0x971;
+resume:
+    switch (ip) {
+    case 0x955: goto L0955;
+    case 0x956: goto L0956;
+    case 0x958: goto L0958;
+    case 0x95a: goto L095a;
+    case 0x95b: goto L095b;
+    case 0x95d: goto L095d;
+    case 0x95e: goto L095e;
+    case 0x95f: goto L095f;
+    case 0x960: goto L0960;
+    case 0x961: goto L0961;
+    case 0x963: goto L0963;
+    case 0x964: goto L0964;
+    case 0x965: goto L0965;
+    case 0x966: goto L0966;
+    case 0x967: goto L0967;
+    case 0x968: goto L0968;
+    case 0x96b: goto L096b;
+    case 0x96d: goto L096d;
+    case 0x970: goto L0970;
+    }
+    return ip;
+}
+
+IU a_0971() {    /// : VARIABLE ;
+    IU ip;
+L0971: A_CALL(0x971, a_094c);
+L0973: PUSH(0x0);
+L0975: A_CALL(0x975, a_0534);
+L0977: A_EXIT(0x977);
+    return 0x978;
+resume:
+    switch (ip) {
+    case 0x971: goto L0971;
+    case 0x973: goto L0973;
+    case 0x975: goto L0975;
+    case 0x977: goto L0977;
+    }
+    return ip;
+}
+
+IU a_0978() {    /// : CONSTANT ;
+    IU ip;
+L0978: A_CALL(0x978, a_0940);
+L097a: PUSH(0x7);
+L097c: A_CALL(0x97c, a_053e);
+L097e: A_CALL(0x97e, a_0162);
+L0980: PUSH(0x4);
+L0982: p_ADD();
+L0983: A_CALL(0x983, a_0534);
+L0985: A_CALL(0x985, a_055e);
+L0988: A_CALL(0x988, a_055e);
+L098b: A_CALL(0x98b, a_0534);
+L098d: A_EXIT(0x98d);
+    return 0x98e;
+resume:
+    switch (ip) {
+    case 0x978: goto L0978;
+    case 0x97a: goto L097a;
+    case 0x97c: goto L097c;
+    case 0x97e: goto L097e;
+    case 0x980: goto L0980;
+    case 0x982: goto L0982;
+    case 0x983: goto L0983;
+    case 0x985: goto L0985;
+    case 0x988: goto L0988;
+    case 0x98b: goto L098b;
+    case 0x98d: goto L098d;
+    }
+    return ip;
+}
+
+IU a_098e() {    /// : 2VARIABLE ;
+    IU ip;
+L098e: A_CALL(0x98e, a_094c);
+L0990: PUSH(0x0);
+L0992: p_DUP();
+L0993: A_CALL(0x993, a_0534);
+L0995: A_CALL(0x995, a_0534);
+L0997: A_EXIT(0x997);
+    return 0x998;
+resume:
+    switch (ip) {
+    case 0x98e: goto L098e;
+    case 0x990: goto L0990;
+    case 0x992: goto L0992;
+    case 0x993: goto L0993;
+    case 0x995: goto L0995;
+    case 0x997: goto L0997;
+    }
+    return ip;
+}
+
+IU a_0998() {    /// : 2CONSTANT ;
+    IU ip;
+L0998: A_CALL(0x998, a_0940);
+L099a: PUSH(0x7);
+L099c: A_CALL(0x99c, a_053e);
+L099e: A_CALL(0x99e, a_0162);
+L09a0: PUSH(0x4);
+L09a2: p_ADD();
+L09a3: A_CALL(0x9a3, a_0534);
+L09a5: A_CALL(0x9a5, a_00a8);
+L09a7: A_CALL(0x9a7, a_055e);
+L09aa: p_SWAP();
+L09ab: A_CALL(0x9ab, a_0534);
+L09ad: A_CALL(0x9ad, a_0534);
+L09af: A_EXIT(0x9af);
+    return 0x9b0;
+resume:
+    switch (ip) {
+    case 0x998: goto L0998;
+    case 0x99a: goto L099a;
+    case 0x99c: goto L099c;
+    case 0x99e: goto L099e;
+    case 0x9a0: goto L09a0;
+    case 0x9a2: goto L09a2;
+    case 0x9a3: goto L09a3;
+    case 0x9a5: goto L09a5;
+    case 0x9a7: goto L09a7;
+    case 0x9aa: goto L09aa;
+    case 0x9ab: goto L09ab;
+    case 0x9ad: goto L09ad;
+    case 0x9af: goto L09af;
+    }
+    return ip;
+}
+
+IU a_09b0() {    /// : (TO) ;
+    IU ip;
+L09b0: A_CALL(0x9b0, a_0102);
+L09b2: p_AT();
+L09b3: PUSH((DU)0x568);
+L09b6: p_EQ();
+L09b7: if (!T) { POP(); goto L09bf; } POP();
+L09ba: p_SWAP();
+L09bb: A_CALL(0x9bb, a_055c);
+L09bd: p_OPC();
+L09be: A_EXIT(0x9be);
+L09bf: PUSH(0xe);
+L09c1: p_EQ();
+L09c2: if (!T) { POP(); goto L09c7; } POP();
+L09c5: p_STORE();
+L09c6: A_EXIT(0x9c6);
+L09c7: p_PSTOR();
+L09c8: A_EXIT(0x9c8);
+    return 0x9c9;
+resume:
+    switch (ip) {
+    case 0x9b0: goto L09b0;
+    case 0x9b2: goto L09b2;
+    case 0x9b3: goto L09b3;
+    case 0x9b6: goto L09b6;
+    case 0x9b7: goto L09b7;
+    case 0x9ba: goto L09ba;
+    case 0x9bb: goto L09bb;
+    case 0x9bd: goto L09bd;
+    case 0x9be: goto L09be;
+    case 0x9bf: goto L09bf;
+    case 0x9c1: goto L09c1;
+    case 0x9c2: goto L09c2;
+    case 0x9c5: goto L09c5;
+    case 0x9c6: goto L09c6;
+    case 0x9c7: goto L09c7;
+    case 0x9c8: goto L09c8;
+    }
+    return ip;
+}
+
+IU a_09c9() {    /// : VALUE ;
+    IU ip;
+L09c9: A_CALL(0x9c9, a_0162);
+L09cb: p_SWAP();
+L09cc: A_CALL(0x9cc, a_0534);
+L09ce: A_CALL(0x9ce, a_0940);
+L09d0: PUSH(0x7);
+L09d2: A_CALL(0x9d2, a_053e);
+L09d4: A_CALL(0x9d4, a_0534);
+L09d6: A_CALL(0x9d6, a_055e);
+L09d9: A_CALL(0x9d9, a_055e);
+L09dc: A_EXIT(0x9dc);
+    return 0x9dd;
+resume:
+    switch (ip) {
+    case 0x9c9: goto L09c9;
+    case 0x9cb: goto L09cb;
+    case 0x9cc: goto L09cc;
+    case 0x9ce: goto L09ce;
+    case 0x9d0: goto L09d0;
+    case 0x9d2: goto L09d2;
+    case 0x9d4: goto L09d4;
+    case 0x9d6: goto L09d6;
+    case 0x9d9: goto L09d9;
+    case 0x9dc: goto L09dc;
+    }
+    return ip;
+}
+
+IU a_09dd() {    /// : TO ;
+    IU ip;
+L09dd: A_CALL(0x9dd, a_0610);
+L09df: p_ONEP();
+L09e0: p_AT();
+L09e1: PUSH(0xe);
+L09e3: A_CALL(0x9e3, a_09b0);
+L09e5: A_EXIT(0x9e5);
+    return 0x9e6;
+resume:
+    switch (ip) {
+    case 0x9dd: goto L09dd;
+    case 0x9df: goto L09df;
+    case 0x9e0: goto L09e0;
+    case 0x9e1: goto L09e1;
+    case 0x9e3: goto L09e3;
+    case 0x9e5: goto L09e5;
+    }
+    return ip;
+}
+
+IU a_09e6() {    /// : +TO ;
+    IU ip;
+L09e6: A_CALL(0x9e6, a_0610);
+L09e8: p_ONEP();
+L09e9: p_AT();
+L09ea: PUSH(0xf);
+L09ec: A_CALL(0x9ec, a_09b0);
+L09ee: A_EXIT(0x9ee);
+    return 0x9ef;
+resume:
+    switch (ip) {
+    case 0x9e6: goto L09e6;
+    case 0x9e8: goto L09e8;
+    case 0x9e9: goto L09e9;
+    case 0x9ea: goto L09ea;
+    case 0x9ec: goto L09ec;
+    case 0x9ee: goto L09ee;
+    }
+    return ip;
+}
+
+IU a_09ef() {    /// : DEFER ;
+    IU ip;
+L09ef: A_CALL(0x9ef, a_0940);
+L09f1: A_CALL(0x9f1, a_055e);
+L09f4: A_CALL(0x9f4, a_0162);
+L09f6: p_CELL();
+L09f7: p_ADD();
+L09f8: A_CALL(0x9f8, a_0534);
+L09fa: A_CALL(0x9fa, a_055e);
+L09fd: A_EXIT(0x9fd);
+    return 0x9fe;
+resume:
+    switch (ip) {
+    case 0x9ef: goto L09ef;
+    case 0x9f1: goto L09f1;
+    case 0x9f4: goto L09f4;
+    case 0x9f6: goto L09f6;
+    case 0x9f7: goto L09f7;
+    case 0x9f8: goto L09f8;
+    case 0x9fa: goto L09fa;
+    case 0x9fd: goto L09fd;
+    }
+    return ip;
+}
+
+IU a_09fe() {    /// : IS ;
+    IU ip;
+L09fe: A_CALL(0x9fe, a_0610);
+L0a00: p_ONEP();
+L0a01: PUSH(0xe);
+L0a03: A_CALL(0xa03, a_09b0);
+L0a05: A_EXIT(0xa05);
+    return 0xa06;
+resume:
+    switch (ip) {
+    case 0x9fe: goto L09fe;
+    case 0xa00: goto L0a00;
+    case 0xa01: goto L0a01;
+    case 0xa03: goto L0a03;
+    case 0xa05: goto L0a05;
+    }
+    return ip;
+}
+
+IU a_0a06() {    /// : MARKER ;
+    IU ip;
+L0a06: A_CALL(0xa06, a_0162);
+L0a08: p_DUP();
+L0a09: p_SNAP();
+L0a0a: A_CALL(0xa0a, a_0547);
+L0a0c: A_CALL(0xa0c, a_0940);
+L0a0e: A_CALL(0xa0e, a_055c);
+L0a10: A_CALL(0xa10, a_055e);
+L0a13: A_CALL(0xa13, a_055e);
+L0a16: A_EXIT(0xa16);
+    return 0xa17;
+resume:
+    switch (ip) {
+    case 0xa06: goto L0a06;
+    case 0xa08: goto L0a08;
+    case 0xa09: goto L0a09;
+    case 0xa0a: goto L0a0a;
+    case 0xa0c: goto L0a0c;
+    case 0xa0e: goto L0a0e;
+    case 0xa10: goto L0a10;
+    case 0xa13: goto L0a13;
+    case 0xa16: goto L0a16;
+    }
+    return ip;
+}
+
+IU a_0a17() {    /// : FORTH-WORDLIST ;
+    IU ip;
+L0a17: A_CALL(0xa17, a_00fa);
+L0a19: A_EXIT(0xa19);
+    return 0xa1a;
+resume:
+    switch (ip) {
+    case 0xa17: goto L0a17;
+    case 0xa19: goto L0a19;
+    }
+    return ip;
+}
+
+IU a_0a1a() {    /// : WORDLIST ;
+    IU ip;
+L0a1a: A_CALL(0xa1a, a_0162);
+L0a1c: PUSH(0x0);
+L0a1e: A_CALL(0xa1e, a_0534);
+L0a20: A_CALL(0xa20, a_013a);
+L0a22: p_AT();
+L0a23: A_CALL(0xa23, a_0534);
+L0a25: p_DUP();
+L0a26: A_CALL(0xa26, a_013a);
+L0a28: p_STORE();
+L0a29: A_EXIT(0xa29);
+    return 0xa2a;
+resume:
+    switch (ip) {
+    case 0xa1a: goto L0a1a;
+    case 0xa1c: goto L0a1c;
+    case 0xa1e: goto L0a1e;
+    case 0xa20: goto L0a20;
+    case 0xa22: goto L0a22;
+    case 0xa23: goto L0a23;
+    case 0xa25: goto L0a25;
+    case 0xa26: goto L0a26;
+    case 0xa28: goto L0a28;
+    case 0xa29: goto L0a29;
+    }
+    return ip;
+}
+
+IU a_0a2a() {    /// : SET-ORDER ;
+    IU ip;
+L0a2a: p_DUP();
+L0a2b: p_ZLT();
+L0a2c: if (!T) { POP(); goto L0a34; } POP();
+L0a2f: p_DROP();
+L0a30: A_CALL(0xa30, a_0a17);
+L0a32: PUSH(0x1);
+L0a34: A_CALL(0xa34, a_013e);
+L0a36: PUSH(0x10);
+L0a38: PUSH(0x0);
+L0a3a: A_CALL(0xa3a, a_019a);
+L0a3c: p_DUP();
+L0a3d: PUSH(0x8);
+L0a3f: p_MIN();
+L0a40: p_SWAP();
+L0a41: p_OVER();
+L0a42: p_SUB();
+L0a43: p_TOR();
+L0a44: A_CALL(0xa44, a_013e);
+L0a46: p_SWAP();
+L0a47: p_TOR();
+L0a48: goto L0a50;
+L0a4b: p_SWAP();
+L0a4c: p_OVER();
+L0a4d: p_STORE();
+L0a4e: p_CELL();
+L0a4f: p_ADD();
+L0a50: if (I-- > 0) { A_LOOP(0xa4b, L0a4b); } RPOP();
+L0a53: p_DROP();
+L0a54: p_RFROM();
+L0a55: p_TOR();
+L0a56: goto L0a5a;
+L0a59: p_DROP();
+L0a5a: if (I-- > 0) { A_LOOP(0xa59, L0a59); } RPOP();
+L0a5d: A_EXIT(0xa5d);
+    return 0xa5e;
+resume:
+    switch (ip) {
+    case 0xa2a: goto L0a2a;
+    case 0xa2b: goto L0a2b;
+    case 0xa2c: goto L0a2c;
+    case 0xa2f: goto L0a2f;
+    case 0xa30: goto L0a30;
+    case 0xa32: goto L0a32;
+    case 0xa34: goto L0a34;
+    case 0xa36: goto L0a36;
+    case 0xa38: goto L0a38;
+    case 0xa3a: goto L0a3a;
+    case 0xa3c: goto L0a3c;
+    case 0xa3d: goto L0a3d;
+    case 0xa3f: goto L0a3f;
+    case 0xa40: goto L0a40;
+    case 0xa41: goto L0a41;
+    case 0xa42: goto L0a42;
+    case 0xa43: goto L0a43;
+    case 0xa44: goto L0a44;
+    case 0xa46: goto L0a46;
+    case 0xa47: goto L0a47;
+    case 0xa48: goto L0a48;
+    case 0xa4b: goto L0a4b;
+    case 0xa4c: goto L0a4c;
+    case 0xa4d: goto L0a4d;
+    case 0xa4e: goto L0a4e;
+    case 0xa4f: goto L0a4f;
+    case 0xa50: goto L0a50;
+    case 0xa53: goto L0a53;
+    case 0xa54: goto L0a54;
+    case 0xa55: goto L0a55;
+    case 0xa56: goto L0a56;
+    case 0xa59: goto L0a59;
+    case 0xa5a: goto L0a5a;
+    case 0xa5d: goto L0a5d;
+    }
+    return ip;
+}
+
+IU a_0a5e() {    /// : GET-ORDER ;
+    IU ip;
+L0a5e: PUSH(0x0);
+L0a60: A_CALL(0xa60, a_013e);
+L0a62: PUSH(0xe);
+L0a64: p_ADD();
+L0a65: PUSH(0x7);
+L0a67: p_TOR();
+L0a68: p_DUP();
+L0a69: p_AT();
+L0a6a: p_QDUP();
+L0a6b: if (!T) { POP(); goto L0a73; } POP();
+L0a6e: p_SWAP();
+L0a6f: p_TOR();
+L0a70: p_SWAP();
+L0a71: p_ONEP();
+L0a72: p_RFROM();
+L0a73: p_CELL();
+L0a74: p_SUB();
+L0a75: if (I-- > 0) { A_LOOP(0xa68, L0a68); } RPOP();
+L0a78: p_DROP();
+L0a79: A_EXIT(0xa79);
+    return 0xa7a;
+resume:
+    switch (ip) {
+    case 0xa5e: goto L0a5e;
+    case 0xa60: goto L0a60;
+    case 0xa62: goto L0a62;
+    case 0xa64: goto L0a64;
+    case 0xa65: goto L0a65;
+    case 0xa67: goto L0a67;
+    case 0xa68: goto L0a68;
+    case 0xa69: goto L0a69;
+    case 0xa6a: goto L0a6a;
+    case 0xa6b: goto L0a6b;
+    case 0xa6e: goto L0a6e;
+    case 0xa6f: goto L0a6f;
+    case 0xa70: goto L0a70;
+    case 0xa71: goto L0a71;
+    case 0xa72: goto L0a72;
+    case 0xa73: goto L0a73;
+    case 0xa74: goto L0a74;
+    case 0xa75: goto L0a75;
+    case 0xa78: goto L0a78;
+    case 0xa79: goto L0a79;
+    }
+    return ip;
+}
+
+IU a_0a7a() {    /// : ONLY ;
+    IU ip;
+L0a7a: PUSH((DU)0xffff);
+L0a7d: A_CALL(0xa7d, a_0a2a);
+L0a7f: A_EXIT(0xa7f);
+    return 0xa80;
+resume:
+    switch (ip) {
+    case 0xa7a: goto L0a7a;
+    case 0xa7d: goto L0a7d;
+    case 0xa7f: goto L0a7f;
+    }
+    return ip;
+}
+
+IU a_0a80() {    /// : ALSO ;
+    IU ip;
+L0a80: A_CALL(0xa80, a_0a5e);
+L0a82: p_OVER();
+L0a83: p_SWAP();
+L0a84: p_ONEP();
+L0a85: A_CALL(0xa85, a_0a2a);
+L0a87: A_EXIT(0xa87);
+    return 0xa88;
+resume:
+    switch (ip) {
+    case 0xa80: goto L0a80;
+    case 0xa82: goto L0a82;
+    case 0xa83: goto L0a83;
+    case 0xa84: goto L0a84;
+    case 0xa85: goto L0a85;
+    case 0xa87: goto L0a87;
+    }
+    return ip;
+}
+
+IU a_0a88() {    /// : PREVIOUS ;
+    IU ip;
+L0a88: A_CALL(0xa88, a_0a5e);
+L0a8a: p_SWAP();
+L0a8b: p_DROP();
+L0a8c: p_ONEM();
+L0a8d: A_CALL(0xa8d, a_0a2a);
+L0a8f: A_EXIT(0xa8f);
+    return 0xa90;
+resume:
+    switch (ip) {
+    case 0xa88: goto L0a88;
+    case 0xa8a: goto L0a8a;
+    case 0xa8b: goto L0a8b;
+    case 0xa8c: goto L0a8c;
+    case 0xa8d: goto L0a8d;
+    case 0xa8f: goto L0a8f;
+    }
+    return ip;
+}
+
+IU a_0a90() {    /// : FORTH ;
+    IU ip;
+L0a90: A_CALL(0xa90, a_0a17);
+L0a92: A_CALL(0xa92, a_013e);
+L0a94: p_STORE();
+L0a95: A_EXIT(0xa95);
+    return 0xa96;
+resume:
+    switch (ip) {
+    case 0xa90: goto L0a90;
+    case 0xa92: goto L0a92;
+    case 0xa94: goto L0a94;
+    case 0xa95: goto L0a95;
+    }
+    return ip;
+}
+
+IU a_0a96() {    /// : DEFINITIONS ;
+    IU ip;
+L0a96: A_CALL(0xa96, a_013e);
+L0a98: p_AT();
+L0a99: A_CALL(0xa99, a_0136);
+L0a9b: p_STORE();
+L0a9c: A_EXIT(0xa9c);
+    return 0xa9d;
+resume:
+    switch (ip) {
+    case 0xa96: goto L0a96;
+    case 0xa98: goto L0a98;
+    case 0xa99: goto L0a99;
+    case 0xa9b: goto L0a9b;
+    case 0xa9c: goto L0a9c;
+    }
+    return ip;
+}
+
+IU a_0a9d() {    /// : VOCABULARY ;
+    IU ip;
+L0a9d: A_CALL(0xa9d, a_0a1a);
+L0a9f: A_CALL(0xa9f, a_0940);
+L0aa1: A_CALL(0xaa1, a_055c);
+L0aa3: PUSH((DU)0x2028);
+L0aa6: A_CALL(0xaa6, a_055c);
+L0aa8: A_CALL(0xaa8, a_055e);
+L0aab: A_CALL(0xaab, a_055e);
+L0aae: A_EXIT(0xaae);
+    return 0xaaf;
+resume:
+    switch (ip) {
+    case 0xa9d: goto L0a9d;
+    case 0xa9f: goto L0a9f;
+    case 0xaa1: goto L0aa1;
+    case 0xaa3: goto L0aa3;
+    case 0xaa6: goto L0aa6;
+    case 0xaa8: goto L0aa8;
+    case 0xaab: goto L0aab;
+    case 0xaae: goto L0aae;
+    }
+    return ip;
+}
+
+IU a_0aaf() {    /// : .( ;
+    IU ip;
+L0aaf: PUSH(0x29);
+L0ab1: A_CALL(0xab1, a_034e);
+L0ab3: A_CALL(0xab3, a_029e);
+L0ab5: A_EXIT(0xab5);
+    return 0xab6;
+resume:
+    switch (ip) {
+    case 0xaaf: goto L0aaf;
+    case 0xab1: goto L0ab1;
+    case 0xab3: goto L0ab3;
+    case 0xab5: goto L0ab5;
+    }
+    return ip;
+}
+
+IU a_0ab6() {    /// : \ ;
+    IU ip;
+L0ab6: PUSH(0xa);
+L0ab8: A_CALL(0xab8, a_0370);
+L0aba: p_DROP();
+L0abb: A_EXIT(0xabb);
+    return 0xabc;
+resume:
+    switch (ip) {
+    case 0xab6: goto L0ab6;
+    case 0xab8: goto L0ab8;
+    case 0xaba: goto L0aba;
+    case 0xabb: goto L0abb;
+    }
+    return ip;
+}
+
+IU a_0abc() {    /// : ( ;
+    IU ip;
+L0abc: PUSH(0x29);
+L0abe: A_CALL(0xabe, a_034e);
+L0ac0: A_CALL(0xac0, a_00b4);
+L0ac2: A_EXIT(0xac2);
+    return 0xac3;
+resume:
+    switch (ip) {
+    case 0xabc: goto L0abc;
+    case 0xabe: goto L0abe;
+    case 0xac0: goto L0ac0;
+    case 0xac2: goto L0ac2;
+    }
+    return ip;
+}
+
+IU a_0ac3() {    /// : COMPILE-ONLY ;
+    IU ip;
+L0ac3: A_CALL(0xac3, a_00fe);
+L0ac5: p_AT();
+L0ac6: p_DUP();
+L0ac7: p_CAT();
+L0ac8: PUSH(0x40);
+L0aca: p_OR();
+L0acb: p_SWAP();
+L0acc: p_CSTOR();
+L0acd: A_EXIT(0xacd);
+    return 0xace;
+resume:
+    switch (ip) {
+    case 0xac3: goto L0ac3;
+    case 0xac5: goto L0ac5;
+    case 0xac6: goto L0ac6;
+    case 0xac7: goto L0ac7;
+    case 0xac8: goto L0ac8;
+    case 0xaca: goto L0aca;
+    case 0xacb: goto L0acb;
+    case 0xacc: goto L0acc;
+    case 0xacd: goto L0acd;
+    }
+    return ip;
+}
+
+IU a_0ace() {    /// : IMMEDIATE ;
+    IU ip;
+L0ace: A_CALL(0xace, a_00fe);
+L0ad0: p_AT();
+L0ad1: p_DUP();
+L0ad2: p_CAT();
+L0ad3: PUSH(0x80);
+L0ad5: p_OR();
+L0ad6: p_SWAP();
+L0ad7: p_CSTOR();
+L0ad8: A_EXIT(0xad8);
+    return 0xad9;
+resume:
+    switch (ip) {
+    case 0xace: goto L0ace;
+    case 0xad0: goto L0ad0;
+    case 0xad1: goto L0ad1;
+    case 0xad2: goto L0ad2;
+    case 0xad3: goto L0ad3;
+    case 0xad5: goto L0ad5;
+    case 0xad6: goto L0ad6;
+    case 0xad7: goto L0ad7;
+    case 0xad8: goto L0ad8;
+    }
+    return ip;
+}
+
+IU a_0ad9() {    /// : INLINE ;
+    IU ip;
+L0ad9: A_CALL(0xad9, a_00fe);
+L0adb: p_AT();
+L0adc: A_CALL(0xadc, a_0379);
+L0ade: p_INLF();
+L0adf: A_EXIT(0xadf);
+    return 0xae0;
+resume:
+    switch (ip) {
+    case 0xad9: goto L0ad9;
+    case 0xadb: goto L0adb;
+    case 0xadc: goto L0adc;
+    case 0xade: goto L0ade;
+    case 0xadf: goto L0adf;
+    }
+    return ip;
+}
+
+IU a_0ae0() {    /// : CLOCK ;
+       p_CLK();
+       A_EXIT(0xae1);
+    return 0xae2;
+}
+
+IU a_0ae2() {    /// : PINMODE ;
+       p_PIN();
+       A_EXIT(0xae3);
+    return 0xae4;
+}
+
+IU a_0ae4() {    /// : MAP ;
+       p_MAP();
+       A_EXIT(0xae5);
+    return 0xae6;
+}
+
+IU a_0ae6() {    /// : IN ;
+       p_IN();
+       A_EXIT(0xae7);
+    return 0xae8;
+}
+
+IU a_0ae8() {    /// : OUT ;
+       p_OUT();
+       A_EXIT(0xae9);
+    return 0xaea;
+}
+
+IU a_0aea() {    /// : AIN ;
+       p_AIN();
+       A_EXIT(0xaeb);
+    return 0xaec;
+}
+
+IU a_0aec() {    /// : PWM ;
+       p_PWM();
+       A_EXIT(0xaed);
+    return 0xaee;
+}
+
+IU a_0aee() {    /// : TMISR ;
+       p_TMISR();
+       A_EXIT(0xaef);
+    return 0xaf0;
+}
+
+IU a_0af0() {    /// : PCISR ;
+       p_PCISR();
+       A_EXIT(0xaf1);
+    return 0xaf2;
+}
+
+IU a_0af2() {    /// : TIMER ;
+       p_TMRE();
+       A_EXIT(0xaf3);
+    return 0xaf4;
+}
+
+IU a_0af4() {    /// : PCINT ;
+       p_PCIE();
+       A_EXIT(0xaf5);
+    return 0xaf6;
+}
+
+IU a_0af6() {    /// : SCHED ;
+       p_SCHED();
+       A_EXIT(0xaf7);
+    return 0xaf8;
+}
+
+IU a_0af8() {    /// : CANCEL ;
+       p_UNSCHED();
+       A_EXIT(0xaf9);
+    return 0xafa;
+}
+
+IU a_0afa() {    /// : ILAT ;
+       p_ILAT();
+       A_EXIT(0xafb);
+    return 0xafc;
+}
+
+IU a_0afc() {    /// : ILAT0 ;
+       p_ILAT0();
+       A_EXIT(0xafd);
+    return 0xafe;
+}
+
+IU a_0afe() {    /// : HWM ;
+       p_HWM();
+       A_EXIT(0xaff);
+    return 0xb00;
+}
+
+IU a_0b00() {    /// : TASK ;
+       p_TASK();
+       A_EXIT(0xb01);
+    return 0xb02;
+}
+
+IU a_0b02() {    /// : QUANTUM ;
+       p_QUANT();
+       A_EXIT(0xb03);
+    return 0xb04;
+}
+
+IU a_0b04() {    /// : CPU ;
+       p_CPU();
+       A_EXIT(0xb05);
+    return 0xb06;
+}
+
+IU a_0b06() {    /// : BANK ;
+       p_BANK();
+       A_EXIT(0xb07);
+    return 0xb08;
+}
+
+IU a_0b08() {    /// : FAR@ ;
+       p_FAT();
+       A_EXIT(0xb09);
+    return 0xb0a;
+}
+
+IU a_0b0a() {    /// : FAR! ;
+       p_FSTOR();
+       A_EXIT(0xb0b);
+    return 0xb0c;
+}
+
+IU a_0b0c() {    /// : FARC@ ;
+       p_FCAT();
+       A_EXIT(0xb0d);
+    return 0xb0e;
+}
+
+IU a_0b0e() {    /// : FARC! ;
+       p_FCSTO();
+       A_EXIT(0xb0f);
+    return 0xb10;
+}
+
+IU a_0b10() {    /// : >FAR ;
+       p_TOFAR();
+       A_EXIT(0xb11);
+    return 0xb12;
+}
+
+IU a_0b12() {    /// : FAR> ;
+       p_FARFR();
+       A_EXIT(0xb13);
+    return 0xb14;
+}
+
+IU a_0b14() {    /// : HEAP ;
+       p_HEAP();
+       A_EXIT(0xb15);
+    return 0xb16;
+}
+
+IU a_0b16() {    /// : ALLOCATE ;
+       p_ALLOC();
+       A_EXIT(0xb17);
+    return 0xb18;
+}
+
+IU a_0b18() {    /// : FREE ;
+       p_FREE();
+       A_EXIT(0xb19);
+    return 0xb1a;
+}
+
+IU a_0b1a() {    /// : RESIZE ;
+       p_RESIZ();
+       A_EXIT(0xb1b);
+    return 0xb1c;
+}
+
+IU a_0b1c() {    /// : ARENA-MARK ;
+       p_AMARK();
+       A_EXIT(0xb1d);
+    return 0xb1e;
+}
+
+IU a_0b1e() {    /// : ARENA-RELEASE ;
+       p_AREL();
+       A_EXIT(0xb1f);
+    return 0xb20;
+}
+
+IU a_0b20() {    /// : DELAY ;
+    IU ip;
+L0b20: p_S2D();
+L0b21: p_CLK();
+L0b22: p_DADD();
+L0b23: A_CALL(0xb23, a_011a);
+L0b25: A_CALL(0xb25, a_009f);
+L0b27: A_CALL(0xb27, a_011a);
+L0b29: A_CALL(0xb29, a_00a8);
+L0b2b: p_CLK();
+L0b2c: p_DSUB();
+L0b2d: p_ZLT();
+L0b2e: p_SWAP();
+L0b2f: p_DROP();
+L0b30: if (!T) { POP(); A_LOOP(0xb27, L0b27); } POP();
+L0b33: A_EXIT(0xb33);
+    return 0xb34;
+resume:
+    switch (ip) {
+    case 0xb20: goto L0b20;
+    case 0xb21: goto L0b21;
+    case 0xb22: goto L0b22;
+    case 0xb23: goto L0b23;
+    case 0xb25: goto L0b25;
+    case 0xb27: goto L0b27;
+    case 0xb29: goto L0b29;
+    case 0xb2b: goto L0b2b;
+    case 0xb2c: goto L0b2c;
+    case 0xb2d: goto L0b2d;
+    case 0xb2e: goto L0b2e;
+    case 0xb2f: goto L0b2f;
+    case 0xb30: goto L0b30;
+    case 0xb33: goto L0b33;
+    }
+    return ip;
+}
+
+IU a_0b34() {    /// : .ILAT ;
+    IU ip;
+L0b34: PUSH(0x8);
+L0b36: p_TOR();
+L0b37: PUSH(0x8);
+L0b39: p_RAT();
+L0b3a: p_SUB();
+L0b3b: p_OVER();
+L0b3c: p_ILAT();
+L0b3d: PUSH(0x6);
+L0b3f: A_CALL(0xb3f, a_02cf);
+L0b41: if (I-- > 0) { A_LOOP(0xb37, L0b37); } RPOP();
+L0b44: p_DROP();
+L0b45: A_EXIT(0xb45);
+    return 0xb46;
+resume:
+    switch (ip) {
+    case 0xb34: goto L0b34;
+    case 0xb36: goto L0b36;
+    case 0xb37: goto L0b37;
+    case 0xb39: goto L0b39;
+    case 0xb3a: goto L0b3a;
+    case 0xb3b: goto L0b3b;
+    case 0xb3c: goto L0b3c;
+    case 0xb3d: goto L0b3d;
+    case 0xb3f: goto L0b3f;
+    case 0xb41: goto L0b41;
+    case 0xb44: goto L0b44;
+    case 0xb45: goto L0b45;
+    }
+    return ip;
+}
+
+IU a_0b46() {    /// : AT-TIME ;
+       PUSH(0x0);
+       p_SCHED();
+       A_EXIT(0xb49);
+    return 0xb4a;
+}
+
+IU a_0b4a() {    /// : AFTER ;
+       p_S2D();
+       p_CLK();
+       p_DADD();
+       PUSH(0x0);
+       p_SCHED();
+       A_EXIT(0xb50);
+    return 0xb51;
+}
+
+IU a_0b51() {    /// : EVERY ;
+       p_DUP();
+       p_TOR();
+       p_S2D();
+       p_CLK();
+       p_DADD();
+       p_RFROM();
+       p_SCHED();
+       A_EXIT(0xb58);
+    return 0xb59;
+}
+
+IU a_0b59() {    /// : COLD ;
+    IU ip;
+L0b59: PUSH((DU)0x1672);
+L0b5c: A_CALL(0xb5c, a_00fa);
+L0b5e: p_STORE();
+L0b5f: PUSH((DU)0x1672);
+L0b62: A_CALL(0xb62, a_00fe);
+L0b64: p_STORE();
+L0b65: PUSH((DU)0x4b9);
+L0b68: A_CALL(0xb68, a_0102);
+L0b6a: p_STORE();
+L0b6b: PUSH((DU)0x525);
+L0b6e: A_CALL(0xb6e, a_0106);
+L0b70: p_STORE();
+L0b71: A_CALL(0xb71, a_02ab);
+L0b73: A_CALL(0xb73, a_0132);
+L0b75: p_AT();
+L0b76: p_QDUP();
+L0b77: if (!T) { POP(); goto L0b7b; } POP();
+L0b7a: A_EXEC(0xb7a);
+L0b7b: A_CALL(0xb7b, a_0525);
+    return 0xb7d;
+resume:
+    switch (ip) {
+    case 0xb59: goto L0b59;
+    case 0xb5c: goto L0b5c;
+    case 0xb5e: goto L0b5e;
+    case 0xb5f: goto L0b5f;
+    case 0xb62: goto L0b62;
+    case 0xb64: goto L0b64;
+    case 0xb65: goto L0b65;
+    case 0xb68: goto L0b68;
+    case 0xb6a: goto L0b6a;
+    case 0xb6b: goto L0b6b;
+    case 0xb6e: goto L0b6e;
+    case 0xb70: goto L0b70;
+    case 0xb71: goto L0b71;
+    case 0xb73: goto L0b73;
+    case 0xb75: goto L0b75;
+    case 0xb76: goto L0b76;
+    case 0xb77: goto L0b77;
+    case 0xb7a: goto L0b7a;
+    case 0xb7b: goto L0b7b;
+    }
+    return ip;
+}
+
+IU aot_exec(IU xt) {
+    switch (xt) {
+    case 0x2: return a_0002();
+    case 0x4: return a_0004();
+    case 0x6: return a_0006();
+    case 0x8: return a_0008();
+    case 0xa: return a_000a();
+    case 0xc: return a_000c();
+    case 0xe: return a_000e();
+    case 0x10: return a_0010();
+    case 0x12: return a_0012();
+    case 0x14: return a_0014();
+    case 0x16: return a_0016();
+    case 0x18: return a_0018();
+    case 0x1a: return a_001a();
+    case 0x1c: return a_001c();
+    case 0x1e: return a_001e();
+    case 0x20: return a_0020();
+    case 0x22: return a_0022();
+    case 0x24: return a_0024();
+    case 0x26: return a_0026();
+    case 0x28: return a_0028();
+    case 0x2a: return a_002a();
+    case 0x2c: return a_002c();
+    case 0x2e: return a_002e();
+    case 0x30: return a_0030();
+    case 0x32: return a_0032();
+    case 0x34: return a_0034();
+    case 0x36: return a_0036();
+    case 0x38: return a_0038();
+    case 0x3a: return a_003a();
+    case 0x3c: return a_003c();
+    case 0x3e: return a_003e();
+    case 0x40: return a_0040();
+    case 0x42: return a_0042();
+    case 0x44: return a_0044();
+    case 0x46: return a_0046();
+    case 0x48: return a_0048();
+    case 0x4a: return a_004a();
+    case 0x4c: return a_004c();
+    case 0x4e: return a_004e();
+    case 0x50: return a_0050();
+    case 0x52: return a_0052();
+    case 0x54: return a_0054();
+    case 0x56: return a_0056();
+    case 0x58: return a_0058();
+    case 0x5a: return a_005a();
+    case 0x5c: return a_005c();
+    case 0x5e: return a_005e();
+    case 0x60: return a_0060();
+    case 0x62: return a_0062();
+    case 0x64: return a_0064();
+    case 0x66: return a_0066();
+    case 0x68: return a_0068();
+    case 0x6a: return a_006a();
+    case 0x6c: return a_006c();
+    case 0x6e: return a_006e();
+    case 0x70: return a_0070();
+    case 0x72: return a_0072();
+    case 0x74: return a_0074();
+    case 0x76: return a_0076();
+    case 0x78: return a_0078();
+    case 0x7a: return a_007a();
+    case 0x7c: return a_007c();
+    case 0x7e: return a_007e();
+    case 0x80: return a_0080();
+    case 0x82: return a_0082();
+    case 0x84: return a_0084();
+    case 0x86: return a_0086();
+    case 0x88: return a_0088();
+    case 0x8a: return a_008a();
+    case 0x8c: return a_008c();
+    case 0x8e: return a_008e();
+    case 0x90: return a_0090();
+    case 0x92: return a_0092();
+    case 0x94: return a_0094();
+    case 0x96: return a_0096();
+    case 0x98: return a_0098();
+    case 0x9a: return a_009a();
+    case 0x9f: return a_009f();
+    case 0xa8: return a_00a8();
+    case 0xb1: return a_00b1();
+    case 0xb4: return a_00b4();
+    case 0xb7: return a_00b7();
+    case 0xbc: return a_00bc();
+    case 0xc3: return a_00c3();
+    case 0xc6: return a_00c6();
+    case 0xc9: return a_00c9();
+    case 0xcc: return a_00cc();
+    case 0xd0: return a_00d0();
+    case 0xd4: return a_00d4();
+    case 0xd8: return a_00d8();
+    case 0xdc: return a_00dc();
+    case 0xde: return a_00de();
+    case 0xe0: return a_00e0();
+    case 0xe2: return a_00e2();
+    case 0xe4: return a_00e4();
+    case 0xe6: return a_00e6();
+    case 0xe8: return a_00e8();
+    case 0xea: return a_00ea();
+    case 0xec: return a_00ec();
+    case 0xee: return a_00ee();
+    case 0xf2: return a_00f2();
+    case 0xf6: return a_00f6();
+    case 0xfa: return a_00fa();
+    case 0xfe: return a_00fe();
+    case 0x102: return a_0102();
+    case 0x106: return a_0106();
+    case 0x10a: return a_010a();
+    case 0x10e: return a_010e();
+    case 0x112: return a_0112();
+    case 0x116: return a_0116();
+    case 0x11a: return a_011a();
+    case 0x11e: return a_011e();
+    case 0x122: return a_0122();
+    case 0x126: return a_0126();
+    case 0x12a: return a_012a();
+    case 0x12e: return a_012e();
+    case 0x132: return a_0132();
+    case 0x136: return a_0136();
+    case 0x13a: return a_013a();
+    case 0x13e: return a_013e();
+    case 0x142: return a_0142();
+    case 0x146: return a_0146();
+    case 0x14a: return a_014a();
+    case 0x14e: return a_014e();
+    case 0x153: return a_0153();
+    case 0x162: return a_0162();
+    case 0x166: return a_0166();
+    case 0x16e: return a_016e();
+    case 0x172: return a_0172();
+    case 0x184: return a_0184();
+    case 0x19a: return a_019a();
+    case 0x1aa: return a_01aa();
+    case 0x1b6: return a_01b6();
+    case 0x1c0: return a_01c0();
+    case 0x1c6: return a_01c6();
+    case 0x1cf: return a_01cf();
+    case 0x1d8: return a_01d8();
+    case 0x1e0: return a_01e0();
+    case 0x1ee: return a_01ee();
+    case 0x1f8: return a_01f8();
+    case 0x207: return a_0207();
+    case 0x20b: return a_020b();
+    case 0x211: return a_0211();
+    case 0x217: return a_0217();
+    case 0x22f: return a_022f();
+    case 0x288: return a_0288();
+    case 0x28b: return a_028b();
+    case 0x29a: return a_029a();
+    case 0x29e: return a_029e();
+    case 0x2ab: return a_02ab();
+    case 0x2b2: return a_02b2();
+    case 0x2bc: return a_02bc();
+    case 0x2bf: return a_02bf();
+    case 0x2c4: return a_02c4();
+    case 0x2cf: return a_02cf();
+    case 0x2df: return a_02df();
+    case 0x2e4: return a_02e4();
+    case 0x2eb: return a_02eb();
+    case 0x2ef: return a_02ef();
+    case 0x343: return a_0343();
+    case 0x34e: return a_034e();
+    case 0x363: return a_0363();
+    case 0x370: return a_0370();
+    case 0x379: return a_0379();
+    case 0x38a: return a_038a();
+    case 0x3b2: return a_03b2();
+    case 0x409: return a_0409();
+    case 0x434: return a_0434();
+    case 0x447: return a_0447();
+    case 0x44d: return a_044d();
+    case 0x468: return a_0468();
+    case 0x48a: return a_048a();
+    case 0x491: return a_0491();
+    case 0x4a2: return a_04a2();
+    case 0x4ab: return a_04ab();
+    case 0x4ad: return a_04ad();
+    case 0x4b9: return a_04b9();
+    case 0x4e6: return a_04e6();
+    case 0x4ed: return a_04ed();
+    case 0x50e: return a_050e();
+    case 0x525: return a_0525();
+    case 0x534: return a_0534();
+    case 0x53e: return a_053e();
+    case 0x547: return a_0547();
+    case 0x54b: return a_054b();
+    case 0x55c: return a_055c();
+    case 0x55e: return a_055e();
+    case 0x566: return a_0566();
+    case 0x568: return a_0568();
+    case 0x5ae: return a_05ae();
+    case 0x5c8: return a_05c8();
+    case 0x5ec: return a_05ec();
+    case 0x610: return a_0610();
+    case 0x61a: return a_061a();
+    case 0x62a: return a_062a();
+    case 0x62f: return a_062f();
+    case 0x636: return a_0636();
+    case 0x644: return a_0644();
+    case 0x649: return a_0649();
+    case 0x64f: return a_064f();
+    case 0x657: return a_0657();
+    case 0x66b: return a_066b();
+    case 0x693: return a_0693();
+    case 0x6a2: return a_06a2();
+    case 0x6f5: return a_06f5();
+    case 0x72b: return a_072b();
+    case 0x765: return a_0765();
+    case 0x76c: return a_076c();
+    case 0x772: return a_0772();
+    case 0x774: return a_0774();
+    case 0x776: return a_0776();
+    case 0x778: return a_0778();
+    case 0x781: return a_0781();
+    case 0x891: return a_0891();
+    case 0x8ac: return a_08ac();
+    case 0x8b6: return a_08b6();
+    case 0x8bc: return a_08bc();
+    case 0x8c4: return a_08c4();
+    case 0x8ca: return a_08ca();
+    case 0x8d4: return a_08d4();
+    case 0x8e2: return a_08e2();
+    case 0x8e8: return a_08e8();
+    case 0x8ec: return a_08ec();
+    case 0x8f0: return a_08f0();
+    case 0x8f5: return a_08f5();
+    case 0x8fb: return a_08fb();
+    case 0x902: return a_0902();
+    case 0x908: return a_0908();
+    case 0x914: return a_0914();
+    case 0x91c: return a_091c();
+    case 0x924: return a_0924();
+    case 0x92e: return a_092e();
+    case 0x937: return a_0937();
+    case 0x940: return a_0940();
+    case 0x94c: return a_094c();
+    case 0x955: return a_0955();
+    case 0x971: return a_0971();
+    case 0x978: return a_0978();
+    case 0x98e: return a_098e();
+    case 0x998: return a_0998();
+    case 0x9b0: return a_09b0();
+    case 0x9c9: return a_09c9();
+    case 0x9dd: return a_09dd();
+    case 0x9e6: return a_09e6();
+    case 0x9ef: return a_09ef();
+    case 0x9fe: return a_09fe();
+    case 0xa06: return a_0a06();
+    case 0xa17: return a_0a17();
+    case 0xa1a: return a_0a1a();
+    case 0xa2a: return a_0a2a();
+    case 0xa5e: return a_0a5e();
+    case 0xa7a: return a_0a7a();
+    case 0xa80: return a_0a80();
+    case 0xa88: return a_0a88();
+    case 0xa90: return a_0a90();
+    case 0xa96: return a_0a96();
+    case 0xa9d: return a_0a9d();
+    case 0xaaf: return a_0aaf();
+    case 0xab6: return a_0ab6();
+    case 0xabc: return a_0abc();
+    case 0xac3: return a_0ac3();
+    case 0xace: return a_0ace();
+    case 0xad9: return a_0ad9();
+    case 0xae0: return a_0ae0();
+    case 0xae2: return a_0ae2();
+    case 0xae4: return a_0ae4();
+    case 0xae6: return a_0ae6();
+    case 0xae8: return a_0ae8();
+    case 0xaea: return a_0aea();
+    case 0xaec: return a_0aec();
+    case 0xaee: return a_0aee();
+    case 0xaf0: return a_0af0();
+    case 0xaf2: return a_0af2();
+    case 0xaf4: return a_0af4();
+    case 0xaf6: return a_0af6();
+    case 0xaf8: return a_0af8();
+    case 0xafa: return a_0afa();
+    case 0xafc: return a_0afc();
+    case 0xafe: return a_0afe();
+    case 0xb00: return a_0b00();
+    case 0xb02: return a_0b02();
+    case 0xb04: return a_0b04();
+    case 0xb06: return a_0b06();
+    case 0xb08: return a_0b08();
+    case 0xb0a: return a_0b0a();
+    case 0xb0c: return a_0b0c();
+    case 0xb0e: return a_0b0e();
+    case 0xb10: return a_0b10();
+    case 0xb12: return a_0b12();
+    case 0xb14: return a_0b14();
+    case 0xb16: return a_0b16();
+    case 0xb18: return a_0b18();
+    case 0xb1a: return a_0b1a();
+    case 0xb1c: return a_0b1c();
+    case 0xb1e: return a_0b1e();
+    case 0xb20: return a_0b20();
+    case 0xb34: return a_0b34();
+    case 0xb46: return a_0b46();
+    case 0xb4a: return a_0b4a();
+    case 0xb51: return a_0b51();
+    case 0xb59: return a_0b59();
+    }
+    return xt;
+}
@@ -9,9 +9,22 @@
 
 #define WORDS_ROW_WIDTH 64          /** WORDS row width control */
 ///
+///> FIND compares the first 2 bytes (length and 1st char) of a name as a cell
+///
+#if CELLSZ==2
+#define NAME_KEY                    /** key cell is 2 bytes already */
+#define NAME_INC    CELL, ADD
+#define NAME_DEC    CELL, SUB
+#else  // CELLSZ==4
+#define NAME_KEY    DOLIT, NAME_MASK, AND,
+#define NAME_INC    BYTE, 2, ADD
+#define NAME_DEC    BYTE, 2, SUB
+#endif // CELLSZ==2
+///
 ///@name eForth Assembler module variables
 ///@{
 IU PC;                              ///< assembler program counter
+IU NP;                              ///< assembler name space pointer (ROM headers)
 U8 R;                               ///< assembler return stack index
 U8 *_byte;                          ///< assembler byte array (heap)
 IU _link;                           ///< link to previous word
@@ -19,14 +32,25 @@ IU _link;                           ///< link to previous word
 ///@name Compiled Address for Branching
 ///@{
 IU DOTQP;                           ///< addr of output ops, used by _dotq, _strq, _abortq
+IU COMPIP;                          ///< addr of COMPILE, its inline opcode byte is data
+///@}
+///@name Word Table and Inline Data (for AOT)
+///@{
+int _wn;                            ///< number of words
+IU  _wxt[WORD_MAX];                 ///< xt of each word
+const char *_wnm[WORD_MAX];         ///< name of each word
+U8  _dat[FORTH_ROM_SZ];             ///< inline data bytes in code space
 ///@}
 ///
 ///> eForth Macro Assembler
 ///
-int assemble(U8 *rom)
+int assemble(U8 *rom, IU nbase)
 {
     _byte = rom;
     _link = R = 0;
+    NP    = nbase;                 ///< ROM headers go to name space at nbase
+    _wn   = COMPIP = 0;
+    memset(_dat, 0, sizeof(_dat));
     ///
     ///> ROM starting address
     ///
@@ -47,6 +71,9 @@ int assemble(U8 *rom)
     IU QBRAN = _PRIM("QBRANCH", QBRAN  );
     IU BRAN  = _PRIM("BRANCH",  BRAN   );
     IU DONXT = _PRIM("DONEXT",  DONEXT );
+    _PRIM("(DO)",    DODO   );
+    _PRIM("(LOOP)",  DOLOOP );
+    _PRIM("(+LOOP)", DOPLOOP);
     IU EXECU = _PRIM("EXECUTE", EXECU  );
     IU STORE = _PRIM("!",       STORE  );
     IU PSTOR = _PRIM("+!",      PSTOR  );
@@ -128,10 +155,11 @@ int assemble(U8 *rom)
     _COLON("2-",    BYTE, 2, SUB, EXIT);
     _COLON("2*",    BYTE, 1, LSH, EXIT);
     _COLON("2/",    BYTE, 1, RSH, EXIT);
-    _COLON("S0",    DOLIT, FORTH_STACK_ADDR, EXIT);   ///> base of data stack (fixed instead of user var)
     _PRIM("SP@",   SPAT);                    ///> address of stack pointer
     _PRIM("I",     RAT );
-    ///  (TODO: add J)
+    _PRIM("J",     J   );                    ///> index of outer DO loop
+    _PRIM("UNLOOP", UNLOOP);                 ///> drop DO loop frame, i.e. UNLOOP EXIT
+    _PRIM("LEAVE", LEAVE);                   ///> leave DO loop
     _PRIM("TRACE", TRC  );                   ///  ( f -- )     enable/disable debug tracing
     _PRIM("SAVE",  SAVE );                   ///  ( -- )       save user variables and dictionary to EEPROM
     _PRIM("LOAD",  LOAD );                   ///  ( -- )       restore user variables and dictionary from EERPROM
@@ -152,6 +180,18 @@ int assemble(U8 *rom)
     IU vIN   = _CODE(">IN",     VAL(ua,9));   ///> * >IN  interpreter pointer to next char
     IU vNTIB = _CODE("#TIB",    VAL(ua,10));  ///> * #TIB number of character received in TIB
     IU vTMP  = _CODE("tmp",     VAL(ua,11));  ///> * tmp storage (alternative to return stack)
+    IU vSP0  = _CODE("SP0",     VAL(ua,12));  ///> * SP0  base of data stack
+    IU vTIB0 = _CODE("TIB0",    VAL(ua,13));  ///> * TIB0 base of terminal input buffer
+    IU vTIBZ = _CODE("/TIB",    VAL(ua,14));  ///> * /TIB size of terminal input buffer
+    IU vNP   = _CODE("NP",      VAL(ua,15));  ///> * NP   name space pointer, grows down from top of dictionary
+    IU vHDR  = _CODE("'HDR",    VAL(ua,16));  ///> * 'HDR where new headers go (0: inline, else name space)
+    IU vBOOT = _CODE("'BOOT",   VAL(ua,17));  ///> * 'BOOT xt run by COLD before QUIT (turnkey application)
+    IU vCRNT = _CODE("CURRENT", VAL(ua,18));  ///> * CURRENT wordlist new words go to
+    IU vVLNK = _CODE("VOC-LINK",VAL(ua,19));  ///> * VOC-LINK last wordlist created (FORTH not included)
+    IU vORDR = _CODE("'ORDER",  VAL(ua,20));  ///> * 'ORDER search order, ORDER_MAX wids, 0 terminated
+    IU vTAIL = _CODE("'TAIL",   VAL(ua,20+ORDER_MAX)); ///> * 'TAIL last colon call compiled (tail call candidate)
+    IU vLIT  = _CODE("'LIT",    VAL(ua,21+ORDER_MAX)); ///> * 'LIT last literal compiled, and the one before (folding)
+    _COLON("S0",    vSP0, AT, EXIT);          ///> base of data stack (set by VM at init)
     ///
     ///> Console Input and Common words
     ///
@@ -164,7 +204,7 @@ int assemble(U8 *rom)
         _THEN(EXIT);
     }
     IU HERE  = _COLON("HERE",  vCP, AT, EXIT);                /// top of dictionary
-    IU PAD   = _COLON("PAD",   DOLIT, FORTH_MAX_ADDR, EXIT);  /// use tail of TIB for output
+    IU PAD   = _COLON("PAD",   vTIB0, AT, vTIBZ, AT, ADD, EXIT); /// use tail of TIB for output
     IU TIB   = _COLON("TIB",   vTTIB, AT, EXIT);
     IU CMOVE = _COLON("CMOVE", NOP); {
         _FOR(NOP);
@@ -301,7 +341,11 @@ int assemble(U8 *rom)
     ///
     ///> Dictionary serach
     ///
-    IU NAMET = _COLON("NAME>", COUNT, BYTE, 0x1f, AND, ADD, EXIT);         /// ( nfa -- cfa )
+    IU NAMET = _COLON("NAME>", DUP, CAT, BYTE, fHDR, AND, SWAP,           /// ( nfa -- cfa )
+                      COUNT, BYTE, 0x1f, AND, ADD, SWAP); {               /// * code follows name
+        _IF(AT);                                                          /// * or xt cell for separated header
+        _THEN(EXIT);
+    }
     IU SAMEQ = _COLON("SAME?", NOP); {                                     /// ( a1 a2 n - a1 a2 f ) compare a1, a2 byte-by-byte
         _FOR(DDUP);
 #if CASE_SENSITIVE
@@ -319,29 +363,38 @@ int assemble(U8 *rom)
     }
     /// TODO: add COMPARE
     IU FIND = _COLON("FIND",                                    /// ( a va -- cfa nfa, a F ) keep length in tmp
-        SWAP, DUP, CAT, vTMP, STORE, DUP, AT, TOR, CELL, ADD, SWAP); { /// fetch 1st cell
+        SWAP, DUP, CAT, vTMP, STORE, DUP, AT, NAME_KEY TOR, NAME_INC, SWAP); { /// fetch 1st cell
         _BEGIN(AT, DUP); {                                      /// 0000 = end of dic
 #if CASE_SENSITIVE
-            _IF(DUP, AT, DOLIT, 0x3fff, AND, RAT, XOR); {       /// compare 2-byte
+            _IF(DUP, AT, DOLIT, NAME_MASK, AND, RAT, XOR); {       /// compare 2-byte
 #else
-            _IF(DUP, AT, DOLIT, 0x3fff, AND,
+            _IF(DUP, AT, DOLIT, NAME_MASK, AND,
                     DOLIT, 0x5f5f, AND, RAT,
                     DOLIT, 0x5f5f, AND, XOR); {                 /// compare 2-byte (uppercased)
 #endif /// CASE_SENSITIVE
-                _IF(CELL, ADD, DOLIT, TRUE);                    /// miss, try next word
-                _ELSE(CELL, ADD, vTMP, AT, ONEM, DUP); {        /// -1, since 1st byte has been compared
+                _IF(NAME_INC, DOLIT, TRUE);                     /// miss, try next word
+                _ELSE(NAME_INC, vTMP, AT, ONEM, DUP); {         /// -1, since 1st byte has been compared
                     _IF(SAMEQ);                                 /// compare strings if larger than 2 bytes
                     _THEN(NOP);
                 }
                 _THEN(NOP);
             }
-            _ELSE(RFROM, DROP, SWAP, CELL, SUB, SWAP, EXIT);
+            _ELSE(RFROM, DROP, SWAP, NAME_DEC, SWAP, EXIT);
             _THEN(NOP);
         }
-        _WHILE(CELL, SUB, CELL, SUB);                                     /// get thread field to previous word
-        _REPEAT(RFROM, DROP, SWAP, DROP, CELL, SUB, DUP, NAMET, SWAP, EXIT);  /// word found, get name field
+        _WHILE(NAME_DEC, CELL, SUB);                                      /// get thread field to previous word
+        _REPEAT(RFROM, DROP, SWAP, DROP, NAME_DEC, DUP, NAMET, SWAP, EXIT);   /// word found, get name field
+    }
+    IU NAMEQ = _COLON("NAME?", vORDR, BYTE, ORDER_MAX-1); {   /// ( a -- ca na | a F ) search wordlists in order
+        _FOR(DUP, AT, QDUP);                                   /// * wid (address of latest nfa)
+        _IF(ROT, SWAP, FIND, QDUP); {
+            _IF(ROT, DROP, RFROM, DROP, EXIT);                 /// * found
+            _THEN(SWAP, CELL, ADD);                            /// * next wordlist
+        }
+        _ELSE(RFROM, DROP, DROP, BYTE, 0, EXIT);               /// * end of search order
+        _THEN(NOP);
+        _NEXT(DROP, BYTE, 0, EXIT);
     }
-    IU NAMEQ = _COLON("NAME?", vCNTX, FIND, EXIT);
     ///
     ///> Terminal Input
     ///
@@ -368,7 +421,7 @@ int assemble(U8 *rom)
         _REPEAT(DROP, OVER, SUB, EXIT);                         /// keep token length in #TIB
     }
     IU EXPEC = _COLON("EXPECT", ACCEP, vSPAN, STORE, DROP, EXIT);
-    IU QUERY = _COLON("QUERY", TIB, BYTE, FORTH_TIB_SZ, ACCEP,
+    IU QUERY = _COLON("QUERY", TIB, vTIBZ, AT, ACCEP,
                       vNTIB, STORE, DROP, BYTE, 0, vIN, STORE, EXIT);
     ///
     ///> Outer Interpreter
@@ -407,7 +460,7 @@ int assemble(U8 *rom)
         _IF(EXECU);                                  /// @EXECUTE
         _THEN(EXIT);
     }
-    /// TODO: add ?STACK
+    IU QSTK  = _PRIM("?STACK", QSTK);               /// abort on stack under/overflow
     IU ERROR = _COLON("ERROR", SPACE, COUNT, TYPE, BYTE, 0x3f, EMIT, CR, ABORT);
     IU INTER = _COLON("$INTERPRET", NAMEQ, QDUP); {  /// scan dictionary for word
         _IF(CAT, BYTE, fCMPL, AND); {                /// check for compile only word
@@ -435,11 +488,11 @@ int assemble(U8 *rom)
         _BEGIN(TOKEN, DUP, CAT);                     /// fetch token length
         _WHILE(vMODE, AT, QDUP); {                   /// fetch operation mode ($INTERPRET or $COMPILE)
             _IF(EXECU);                              /// execute according to mode
-            _THEN(NOP);
+            _THEN(QSTK);                             /// check stacks after each token
         }
         _REPEAT(DROP, DOTOK, EXIT);
     }
-    IU QUIT = _COLON("QUIT", DOLIT, FORTH_TIB_ADDR, vTTIB, STORE, iLBRAC); {  /// clear TIB, interpreter mode
+    IU QUIT = _COLON("QUIT", vTIB0, AT, vTTIB, STORE, iLBRAC); {  /// clear TIB, interpreter mode
         _BEGIN(QUERY, EVAL);                         /// main query-eval loop
         _AGAIN(NOP);
     }
@@ -449,19 +502,33 @@ int assemble(U8 *rom)
     IU COMMA = _COLON(",",  HERE, DUP, CELL, ADD, vCP, STORE, STORE, EXIT);   /// store a byte
     IU CCMMA = _COLON("C,", HERE, DUP, ONEP,  vCP, STORE, CSTOR, EXIT);       /// store a word
     IU ALLOT = _COLON("ALLOT",    vCP, PSTOR, EXIT);
-    IU iLITR = _IMMED("LITERAL",  DUP, DOLIT, 0xff00, AND); {
-        _IF(BYTE, opDOLIT, CCMMA, COMMA);            /// create a literal
-        _ELSE(BYTE, opBYTE, CCMMA, CCMMA);           /// 8-bit literal
-        _THEN(EXIT);
-    }
+#if CELLSZ==2
+    IU XTCMA = _COLON("COMPILE,", HERE, vTAIL, STORE,        /// ( xt -- ) append colon call, high-byte first
+                      DUP, BYTE, 8, RSH,
+                      BYTE, fCOLON8, OR, CCMMA, CCMMA, EXIT);
+#else  // CELLSZ==4
+    IU XTCMA = _COLON("COMPILE,", HERE, vTAIL, STORE,        /// ( xt -- ) append colon call, high-byte first
+                      DUP, BYTE, 24, RSH,
+                      BYTE, fCOLON8, OR, CCMMA,
+                      DUP, BYTE, 16, RSH, CCMMA, DUP, BYTE, 8, RSH, CCMMA, CCMMA, EXIT);
+#endif // CELLSZ==2
+    IU iLITR = _IMMED("LITERAL",  opLITC, EXIT);             /// 8-bit or cell literal, kept for folding
     IU COMPI = _COLON("COMPILE",  RFROM, DUP, CAT, CCMMA, ONEP, TOR, EXIT);
+       COMPIP = COMPI;                                        /// Note: its inline byte is data
+    IU INLN  = _PRIM("INLINE,", INL);                         /// ( xt -- f ) append body of xt if inlinable
     IU SCOMP = _COLON("$COMPILE", NAMEQ, QDUP); {    /// name found?
         _IF(CAT, BYTE, fIMMD, AND); {                /// is immediate?
             _IF(EXECU);                              /// execute
             _ELSE(DUP, DUP, DOLIT, FORTH_ROM_SZ, LT, /// a primitive?
-                SWAP, ONEP, CAT, BYTE, opEXIT, EQ, AND); {  /// XX08 <= this might break
-                _IF(CAT, CCMMA);                     /// append just the opcode
-                _ELSE(DOLIT, fCOLON16, OR, COMMA);   /// append colon word address with flag
+                SWAP, ONEP, CAT, BYTE, opEXIT, EQ, AND,     /// * [op][EXIT]
+                OVER, CAT, BYTE, opBYTE, BYTE, opDOLIT+1,   /// * but not a literal 1, i.e. U.
+                WITHI, ZEQ, AND); {
+                _IF(CAT, opOPC);                     /// append just the opcode, literals folded
+                _ELSE(DUP, INLN, ZEQ); {             /// short body copied in place?
+                    _IF(XTCMA);                      /// append colon word address with flag
+                    _ELSE(DROP);
+                    _THEN(NOP);
+                }
                 _THEN(NOP);
             }
             _THEN(EXIT);
@@ -476,27 +543,58 @@ int assemble(U8 *rom)
         }
         _THEN(DROP, EXIT);
     }
+    IU SHDR  = _COLON("$,h", DUP, CAT, ONEP, TOR,                 /// ( na -- nfa ) move name to name space
+        vNP, AT, RAT, SUB, CELL, SUB, DUP, CELL, SUB, vNP, STORE,  /// * room for link, name and xt
+        SWAP, OVER, RAT, CMOVE,                                    /// * copy name
+        HERE, OVER, RFROM, ADD, STORE,                             /// * xt cell points to code at HERE
+        DUP, CAT, BYTE, fHDR, OR, OVER, CSTOR, EXIT);              /// * flag separated header
     IU SNAME = _COLON("$,n", DUP, AT); {  /// add new name field which is already build by PACK$
-        _IF(UNIQU,
+        _IF(UNIQU, vHDR, AT); {
+            _IF(SHDR);                    /// * header into name space
+            _THEN(NOP);
+        }
+        _THEN(
             DUP, NAMET, vCP, STORE,    DUP, vLAST, STORE,
-            CELL, SUB, vCNTX, AT, SWAP, STORE, EXIT);
+            CELL, SUB, vCRNT, AT, AT, SWAP, STORE, EXIT);
         _THEN(ERROR);
     }
     IU TICK  = _COLON("'", TOKEN, NAMEQ); {
         _IF(EXIT);
         _THEN(ERROR);
     }
-    IU RBRAC = _COLON("]", DOLIT, SCOMP, vMODE, STORE, EXIT);  /// switch into compiler-mode
+    IU RBRAC = _COLON("]", DOLIT, SCOMP, vMODE, STORE,        /// switch into compiler-mode
+                      BYTE, 0, DUP, vTAIL, STORE, vLIT, STORE, EXIT);   /// * nothing to tail call or fold yet
     /// TODO: add [']
-    _IMMED("[COMPILE]", TICK, COMMA, EXIT);                    /// add word address to dictionary
+    _IMMED("[COMPILE]", TICK, XTCMA, EXIT);                    /// add word address to dictionary
     _COLON(":", TOKEN, SNAME, RBRAC, EXIT);
-    _IMMED(";", COMPI, opEXIT, iLBRAC, vLAST, AT, vCNTX, STORE, EXIT);
+    _IMMED(";", opTAIL, COMPI, opEXIT, iLBRAC, vLAST, AT, vCRNT, AT, STORE, EXIT);  /// * trailing call into a jump
+    _IMMED("EXIT",    opTAIL, COMPI, opEXIT, EXIT);           /// mid-word EXIT, tail call too
+    _IMMED("NOTAIL",  BYTE, 0, vTAIL, STORE, EXIT);           /// keep the call before it a call
+    _IMMED("RECURSE", vLAST, AT, NAMET, XTCMA, EXIT);         /// call the word being defined
     ///
     ///> Debugging Tools
     ///
-    IU TNAME = _COLON(">NAME", NOP); {                         /// ( pfa -- nfa )
-        _BEGIN(ONEM, DUP, CAT, BYTE, 0x7f, AND, BYTE, 0x20, LT);
-        _UNTIL(EXIT);
+    IU WNAME = _COLON("(>NAME)", NOP); {                      /// ( xt wid -- xt nfa | xt 0 )
+        _BEGIN(AT, DUP);                                       /// 0000 = end of dic
+        _WHILE(DDUP, NAMET, EQ); {
+            _IF(EXIT);                                         /// found
+            _THEN(CELL, SUB);                                  /// link to prev word
+        }
+        _REPEAT(EXIT);
+    }
+    IU TNAME = _COLON(">NAME", vCNTX, WNAME, QDUP); {          /// ( xt -- nfa | 0 ) headerless gives 0
+        _IF(SWAP, DROP, EXIT);                                 /// * in FORTH wordlist
+        _THEN(vVLNK);
+        _BEGIN(AT, DUP);                                       /// * then every other wordlist
+        _WHILE(DUP, TOR, WNAME, QDUP); {
+            _IF(SWAP, DROP, RFROM, DROP, EXIT);
+            _THEN(RFROM, CELL, ADD);                           /// * link to prev wordlist
+        }
+        _REPEAT(SWAP, DROP, EXIT);
+    }
+    IU DOTID = _COLON(".ID", QDUP); {                          /// ( nfa | 0 -- ) display name
+        _IF(COUNT, BYTE, 0x1f, AND, TYPE, EXIT);
+        _THEN(BYTE, 0x3f, EMIT, EXIT);                         /// ? for headerless word
     }
     _COLON("DUMP", vBASE, AT, TOR, HEX_,                       /// save BASE, make HEX
         BYTE, 0x1f, ADD, BYTE, 0x10, DIV); {                   /// get row count
@@ -516,7 +614,7 @@ int assemble(U8 *rom)
         _THEN(NOP);
         _NEXT(DROP, RFROM, vBASE, STORE, EXIT);                /// restore BASE
     }
-    _COLON("WORDS", CR, vCNTX, BYTE, 0, vTMP, STORE); {        /// tmp keeps width
+    _COLON("WORDS", CR, vORDR, AT, BYTE, 0, vTMP, STORE); {   /// first wordlist in search order, tmp keeps width
         _BEGIN(AT, QDUP);
         _WHILE(DUP, COUNT, BYTE, 0x1f, AND,                    /// get name length
              DUP, ONEP, ONEP, vTMP, PSTOR,                     /// add to tmp
@@ -527,19 +625,38 @@ int assemble(U8 *rom)
         }
         _REPEAT(EXIT);
     }
-    _COLON("FORGET", TOKEN, NAMEQ, QDUP); {
-        _IF(CELL, SUB, DUP, vCP, STORE, AT, DUP, vCNTX, STORE, vLAST, STORE, DROP, EXIT);
+    _COLON("FORGET", TOKEN, vCRNT, AT, FIND, QDUP); {         /// in CURRENT wordlist only
+        _IF(DUP, CAT, BYTE, fHDR, AND); {
+            _IF(OVER, vCP, STORE,                              /// * separated, CP back to xt
+                DUP, COUNT, BYTE, 0x1f, AND, ADD, CELL, ADD, vNP, STORE);  /// * reclaim name space
+            _ELSE(DUP, CELL, SUB, vCP, STORE);                 /// * inline, CP back to link field
+            _THEN(CELL, SUB, AT, DUP, vCRNT, AT, STORE, vLAST, STORE, DROP, EXIT);
+        }
         _THEN(ERROR);
     }
+    _COLON("HEADERLESS", DOLIT, TRUE, vHDR, STORE, EXIT);      /// new headers go to name space
+    _COLON("HEADERS",    BYTE, FALSE, vHDR, STORE, EXIT);     /// new headers inline with code
+    _PRIM("PRUNE", PRUNE);                                     /// drop headers in name space
+    IU SNAP  = _PRIM("SNAPSHOT", SNAP);                        /// ( a -- n ) save VM state at a, n bytes
+    _PRIM("RESTORE", RESTO);                                   /// ( a -- ) roll VM state back to snapshot a
 #if ENABLE_SEE
     /// Optional: Takes ~300 bytes ROM space
     ///> display address with colon delimiter ( a -- )
     IU DOTAD = _COLON(".ADDR", CR, DUP, DOT, BYTE, 0x3a, EMIT, EXIT);
+#if MEM_NATIVE
+    ///> fetch a call token, kept high-byte first ( a -- xt )
+    IU XTAT  = _COLON("XT@", BYTE, 0, SWAP, BYTE, CELLSZ-1); {
+        _FOR(TOR, BYTE, 8, LSH, RAT, CAT, OR, RFROM, ONEP);
+        _NEXT(DROP, EXIT);
+    }
+#else  // !MEM_NATIVE
+    IU XTAT  = AT;                                             /// call token is a cell
+#endif // MEM_NATIVE
     ///> display opcode at given address ( a0 op -- a1 )
     IU DOTOP = _COLON(".OP", DUP, BYTE, fCOLON8, AND); {       /// check primitive flag?
         /* poorman's CASE */
-        _IF(DROP, DUP, AT, DOLIT, 0x7fff, AND, DUP,            /// colon word - show name
-            SPACE, TNAME, COUNT, TYPE, DUP,
+        _IF(DROP, DUP, XTAT, DOLIT, fCOLON-1, AND, DUP,        /// colon word - show name
+            SPACE, TNAME, DOTID, DUP,
             DOLIT, DOTQP, EQ, SWAP, DOLIT, STRQP, EQ, OR); {
             _IF(SPACE, CELL, ADD, COUNT, DDUP, TYPE,           /// ."| or $"| (string)"
                 BYTE, 0x22, EMIT, ADD, EXIT);
@@ -562,6 +679,9 @@ int assemble(U8 *rom)
         _THEN(DUP, BYTE, opDONEXT, EQ);                        /// a bran or donext?
         _IF(DROP, ONEP, DUP, AT, DOT,                          /// show jump target
             BYTE, 0x6e, EMIT, CELL, ADD, DOTAD, EXIT);         /// (jump target)n
+        _THEN(DUP, BYTE, opDODO, BYTE, opDOPLOOP+1, WITHI);   /// DO, LOOP or +LOOP
+        _IF(DROP, ONEP, DUP, AT, DOT,                          /// show jump target
+            BYTE, 0x6c, EMIT, CELL, ADD, DOTAD, EXIT);         /// (jump target)l
         _THEN(DUP, BYTE, opDOES, EQ);                          /// DOES>
         _IF(DROP, ONEP, DUP, CAT, SWAP,
             DUP, ONEP, AT, DOT, BYTE, 0x2a, EMIT,              /// (var)*
@@ -573,7 +693,7 @@ int assemble(U8 *rom)
         _WHILE(DUP, NAMET,                                     /// primitive words?
                DUP, ONEP, CAT, BYTE, opEXIT, EQ); {            /// * check second byte is EXIT
             _IF(CAT, TOR, OVER, RFROM, EQ); {                  /// same as our opcode?
-                _IF(COUNT, TYPE, DROP, ONEP, EXIT);            /// print name, done!
+                _IF(DOTID, DROP, ONEP, EXIT);                  /// print name, done!
                 _THEN(DUP);
             }
             _THEN(DROP, CELL, SUB);                            /// link to prev word
@@ -593,13 +713,14 @@ int assemble(U8 *rom)
     ///
     IU iAHEAD = _IMMED("AHEAD", COMPI, opBRAN, HERE, BYTE, 0, COMMA, EXIT);
     IU iAGAIN = _IMMED("AGAIN", COMPI, opBRAN, COMMA, EXIT);
-    _IMMED("BEGIN", HERE, EXIT);
-    _IMMED("UNTIL", COMPI, opQBRAN, EXIT);
+    _IMMED("BEGIN", HERE, BYTE, 0, vLIT, STORE, EXIT);        /// * HERE is a branch target
+    _IMMED("UNTIL", COMPI, opQBRAN, COMMA, EXIT);
     ///
     ///> * f IF...THEN, f IF...ELSE...THEN
     ///
     IU iIF    = _IMMED("IF",   COMPI, opQBRAN, HERE, BYTE, 0, COMMA, EXIT);
-    IU iTHEN  = _IMMED("THEN", HERE, SWAP, STORE, EXIT);
+    IU iTHEN  = _IMMED("THEN", HERE, SWAP, STORE,              /// * HERE is a branch target
+                       BYTE, 0, DUP, vTAIL, STORE, vLIT, STORE, EXIT);
     _IMMED("ELSE",  iAHEAD, SWAP, iTHEN, EXIT);
     _IMMED("WHILE", iIF, SWAP, EXIT);
     _IMMED("WHEN",  iIF, OVER, EXIT);
@@ -607,22 +728,26 @@ int assemble(U8 *rom)
     ///
     ///> * n FOR...NEXT, n FOR...(first)... f AFT...(2nd,...)...THEN...(every)...NEXT
     ///
-    /// TODO: add DO...LOOP, +LOOP, LEAVE
-    ///
     _IMMED("FOR",   COMPI, opTOR, HERE, EXIT);
     _IMMED("AFT",   DROP, iAHEAD, HERE, SWAP, EXIT);
     _IMMED("NEXT",  COMPI, opDONEXT, COMMA, EXIT);
     ///
+    ///> * limit index DO...LOOP, limit index DO...n +LOOP, LEAVE and UNLOOP inside
+    ///
+    _IMMED("DO",    COMPI, opDODO, HERE, BYTE, 0, COMMA, HERE, EXIT);  /// * exit address resolved by LOOP
+    _IMMED("LOOP",  COMPI, opDOLOOP,  COMMA, iTHEN, EXIT);
+    _IMMED("+LOOP", COMPI, opDOPLOOP, COMMA, iTHEN, EXIT);
+    ///
     ///> String Literals
     ///
     IU STRCQ  = _COLON("$,\"", BYTE, 0x22, WORD,       /// find quote in TIB (0x22 is " in ASCII)
                     COUNT, ADD, vCP, STORE, EXIT);      /// advance dic pointer
-    _IMMED("$\"",   DOLIT, STRQP | fCOLON16, HERE, STORE, STRCQ, EXIT);
-    _IMMED(".\"",   DOLIT, DOTQP | fCOLON16, HERE, STORE, STRCQ, EXIT);
+    _IMMED("$\"",   DOLIT, XT_LIT(STRQP), HERE, STORE, STRCQ, EXIT);
+    _IMMED(".\"",   DOLIT, XT_LIT(DOTQP), HERE, STORE, STRCQ, EXIT);
     ///
     ///> Defining Words - variable, constant, and comments
     ///
-    IU CODE  = _COLON("CODE", TOKEN, SNAME, vLAST, AT, vCNTX, STORE, EXIT);
+    IU CODE  = _COLON("CODE", TOKEN, SNAME, vLAST, AT, vCRNT, AT, STORE, EXIT);
     IU CREAT = _COLON("CREATE", CODE, COMPI, opDOVAR, COMPI, opEXIT, EXIT);
     _COLON("DOES>",                                             ///> change runtime behavior to following code
            RFROM, HERE, vLAST, AT, NAMET, DUP, TOR, SUB, ONEM,  /// ( ra ca ) para on return stack, offset to defining word
@@ -631,12 +756,62 @@ int assemble(U8 *rom)
     /// TODO: add POSTPONE
     _COLON("VARIABLE",  CREAT, BYTE, 0, COMMA, EXIT);
     _COLON("CONSTANT",  CODE,                                   /// * CC: Dr. Ting hardcoded here
-           BYTE, opDOLIT, CCMMA, HERE, BYTE, 4, ADD, COMMA,     /// * calculate addr of constant
+           BYTE, opDOLIT, CCMMA, HERE, BYTE, CELLSZ+2, ADD, COMMA, /// * calculate addr of constant
            COMPI, opAT, COMPI, opEXIT, COMMA, EXIT);
     _COLON("2VARIABLE", CREAT, BYTE, 0, DUP, COMMA, COMMA, EXIT);
     _COLON("2CONSTANT", CODE,
            BYTE, opDOLIT, CCMMA, HERE, BYTE, 4, ADD, COMMA,
            DAT, COMPI, opEXIT, SWAP, COMMA, COMMA, EXIT);
+    IU TOCMP = _COLON("(TO)", vMODE, AT, DOLIT, SCOMP, EQ); {   /// ( n a op -- ) ! or +! now, or compile a and op
+        _IF(SWAP, iLITR, opOPC, EXIT);
+        _THEN(BYTE, opSTORE, EQ);
+        _IF(STORE, EXIT);
+        _THEN(PSTOR, EXIT);
+    }
+    _COLON("VALUE",     HERE, SWAP, COMMA, CODE,                /// * value kept ahead of the word, so not a CONSTANT
+           BYTE, opDOLIT, CCMMA, COMMA, COMPI, opAT, COMPI, opEXIT, EXIT);
+    _IMMED("TO",        TICK, ONEP, AT, BYTE, opSTORE, TOCMP, EXIT);
+    _IMMED("+TO",       TICK, ONEP, AT, BYTE, opPSTOR, TOCMP, EXIT);
+    _COLON("DEFER",     CODE, COMPI, opBRAN, HERE, CELL, ADD, COMMA, /// * a jump to its action, its own EXIT until IS
+           COMPI, opEXIT, EXIT);
+    _IMMED("IS",        TICK, ONEP, BYTE, opSTORE, TOCMP, EXIT);
+    _COLON("MARKER",    HERE, DUP, SNAP, ALLOT,                 /// * snapshot first, so the marker goes too
+           CODE, iLITR, COMPI, opRESTO, COMPI, opEXIT, EXIT);
+    ///
+    ///> Wordlists and search order (wid is the address of the latest name field)
+    ///
+    IU FWID  = _COLON("FORTH-WORDLIST", vCNTX, EXIT);             /// ( -- wid ) ROM and default words
+    IU WLIST = _COLON("WORDLIST", HERE, BYTE, 0, COMMA,           /// ( -- wid ) new empty wordlist
+           vVLNK, AT, COMMA, DUP, vVLNK, STORE, EXIT);            /// * chained for PRUNE and >NAME
+    IU SORDR = _COLON("SET-ORDER", DUP, ZLT); {                   /// ( widn..wid1 n -- ) -1: FORTH only
+        _IF(DROP, FWID, BYTE, 1);
+        _THEN(vORDR, BYTE, ORDER_MAX*CELLSZ, BYTE, 0, FILL,
+            DUP, BYTE, ORDER_MAX, MIN, SWAP, OVER, SUB, TOR,     /// * wids past ORDER_MAX are dropped
+            vORDR, SWAP); {
+            _FOR(NOP);
+            _AFT(SWAP, OVER, STORE, CELL, ADD);
+            _THEN(NOP);
+            _NEXT(DROP, RFROM);
+        }
+        _FOR(NOP);
+        _AFT(DROP);
+        _THEN(NOP);
+        _NEXT(EXIT);
+    }
+    IU GORDR = _COLON("GET-ORDER", BYTE, 0,                       /// ( -- widn..wid1 n )
+           vORDR, BYTE, (ORDER_MAX-1)*CELLSZ, ADD, BYTE, ORDER_MAX-1); {
+        _FOR(DUP, AT, QDUP);
+        _IF(SWAP, TOR, SWAP, ONEP, RFROM);
+        _THEN(CELL, SUB);
+        _NEXT(DROP, EXIT);
+    }
+    _COLON("ONLY",        DOLIT, TRUE, SORDR, EXIT);
+    _COLON("ALSO",        GORDR, OVER, SWAP, ONEP, SORDR, EXIT);  /// duplicate first wordlist
+    _COLON("PREVIOUS",    GORDR, SWAP, DROP, ONEM, SORDR, EXIT);  /// drop first wordlist
+    _COLON("FORTH",       FWID, vORDR, STORE, EXIT);              /// FORTH as first wordlist
+    _COLON("DEFINITIONS", vORDR, AT, vCRNT, STORE, EXIT);         /// new words go to first wordlist
+    _COLON("VOCABULARY",  WLIST, CODE, iLITR,                     /// ( -- ) named wordlist, replaces first
+           DOLIT, ua+CELLSZ*20, iLITR, COMPI, opSTORE, COMPI, opEXIT, EXIT);
     ///
     ///> Comments
     ///
@@ -650,6 +825,8 @@ int assemble(U8 *rom)
         CAT, BYTE, fCMPL, OR, SWAP, CSTOR, EXIT);
     _COLON("IMMEDIATE",    vLAST, AT, DUP,              /// enable IMMEDIATE flag
         CAT, BYTE, fIMMD, OR, SWAP, CSTOR, EXIT);
+    _COLON("INLINE",       vLAST, AT, NAMET,            /// flag last word for inlining (leading opENTER)
+        opINLF, EXIT);
     ///
     ///> Arduino specific opcodes
     ///
@@ -664,20 +841,52 @@ int assemble(U8 *rom)
     _PRIM("PCISR",    PCISR);       ///  ( xt p -- )  on pin change interrupt calls xt
     _PRIM("TIMER",    TMRE );       ///  ( f -- )     enable/disable timer interrupt
     _PRIM("PCINT",    PCIE );       ///  ( f -- )     enable/disable pin change interrupt
+    IU SCHED = _PRIM("SCHED", SCHED); /// ( xt d n -- ) run xt at CLOCK d, then every n ms (0: once)
+    _PRIM("CANCEL",   UNSCHED);     ///  ( xt -- )    remove xt from scheduled jobs
+    IU ILAT = _PRIM("ILAT", ILAT);  ///  ( b v -- n ) ISR v latency count in bucket b (< 32us << b), b=8: max in us
+    _PRIM("ILAT0",    ILAT0);       ///  ( -- )       reset ISR latency statistics
+    _PRIM("HWM",      HWM  );       ///  ( n -- u )   stack high-water mark in cells (0:S 1:R 2:ISR S 3:ISR R)
+    _PRIM("TASK",     TASK );       ///  ( xt a n -- t ) create task t running xt, stacks in [a, a+n)
+    _PRIM("QUANTUM",  QUANT);       ///  ( n -- )     switch task every n instructions (0: off)
+    _PRIM("CPU",      CPU  );       ///  ( t -- ud )  instructions executed by task t
+    _PRIM("BANK",     BANK );       ///  ( n -- )     select 64K bank n of far memory
+    _PRIM("FAR@",     FAT  );       ///  ( a -- n )   fetch cell from far memory
+    _PRIM("FAR!",     FSTOR);       ///  ( n a -- )   store cell into far memory
+    _PRIM("FARC@",    FCAT );       ///  ( a -- c )   fetch byte from far memory
+    _PRIM("FARC!",    FCSTO);       ///  ( c a -- )   store byte into far memory
+    _PRIM(">FAR",     TOFAR);       ///  ( a fa n -- ) copy n bytes from RAM to far memory
+    _PRIM("FAR>",     FARFR);       ///  ( fa a n -- ) copy n bytes from far memory to RAM
+    _PRIM("HEAP",     HEAP );       ///  ( a n -- )   use RAM [a, a+n) for ALLOCATE and arena
+    _PRIM("ALLOCATE", ALLOC);       ///  ( u -- a ior ) allocate u bytes, pool block if small enough
+    _PRIM("FREE",     FREE );       ///  ( a -- ior ) free a pool block (arena blocks wait for ARENA-RELEASE)
+    _PRIM("RESIZE",   RESIZ);       ///  ( a u -- a' ior ) resize block, content kept
+    _PRIM("ARENA-MARK",    AMARK);  ///  ( -- m )     mark arena top
+    _PRIM("ARENA-RELEASE", AREL );  ///  ( m -- )     release arena blocks allocated since mark m
     _COLON("DELAY", S2D, CLK, DADD, vTMP, DSTOR); {
         _BEGIN(vTMP, DAT, CLK, DSUB, ZLT, SWAP, DROP);
         _UNTIL(EXIT);
     }
+    _COLON(".ILAT", BYTE, 8); {                              ///  ( v -- )     show ISR v latency histogram and max
+        _FOR(BYTE, 8, RAT, SUB, OVER, ILAT, BYTE, 6, UDOTR);
+        _NEXT(DROP, EXIT);
+    }
+    _COLON("AT-TIME", BYTE, 0, SCHED, EXIT);                  ///  ( xt d -- )  run xt once at CLOCK d
+    _COLON("AFTER",   S2D, CLK, DADD, BYTE, 0, SCHED, EXIT);  ///  ( xt n -- )  run xt once, n ms from now
+    _COLON("EVERY",   DUP, TOR, S2D, CLK, DADD,               ///  ( xt n -- )  run xt every n ms, phase-locked
+           RFROM, SCHED, EXIT);
     ///
     ///> Cold Start address (End of dictionary)
     ///
-    IU  last = PC + CELLSZ;                 /// name field of last word
+    IU  last = NP + CELLSZ;                 /// name field of last word
     IU  COLD = _COLON("COLD",
             DOLIT, last,  vCNTX, STORE,     /// reset vectors
             DOLIT, last,  vLAST, STORE,
             DOLIT, INTER, vMODE, STORE,
             DOLIT, QUIT,  vTABRT,STORE,
-            CR, QUIT);                      /// enter the main query loop (QUIT)
+            CR, vBOOT, AT, QDUP); {         /// turnkey application?
+        _IF(EXECU);
+        _THEN(QUIT);                        /// enter the main query loop (QUIT)
+    }
     int here  = PC;                         /// current pointer
     ///
     ///> Boot Vector Setup
@@ -689,7 +898,20 @@ int assemble(U8 *rom)
 ///
 /// create C array dump for ROM
 ///
-void _dump_rom(U8* rom, int len)
+void _dump_row(U8* rom, int p)
+{
+    U32 *x = (U32*)&rom[p];
+    for (int i=0; i<0x8; i++, x++) {
+        printf("0x%08x,", *x);
+    }
+    printf(" // %04x ", p);
+    for (int i=0; i<0x20; i++) {
+        U8 c = rom[p+i];
+        printf("%c", c ? ((c!=0x5c && c>0x1f && c<0x7f) ? c : '_') : '.');
+    }
+    printf("\n");
+}
+void _dump_rom(U8* rom, int code, int len)
 {
     printf(
         "///\n"
@@ -698,36 +920,147 @@ void _dump_rom(U8* rom, int len)
         "/// @attention 8K max ROM before changing FORTH_ROM_SZ in eforth_config.h \n"
         "///\n"
         "#include <stdint.h>\n"
+        "#include \"eforth_config.h\"\n"
         "#if ARDUINO\n"
         "#include <Arduino.h>\n"
         "#else\n"
         "#define PROGMEM\n"
-        "#endif\n");
+        "#endif\n"
+        "/// @note cells in %s byte order (MEM_NATIVE=%d)\n", MEM_NATIVE ? "native" : "big-endian", MEM_NATIVE);
+    printf("\n#if FORTH_TURNKEY  /// names stripped");
+    printf("\nconst uint32_t forth_rom_sz PROGMEM = 0x%x;", code);
+    printf("\n#else");
     printf("\nconst uint32_t forth_rom_sz PROGMEM = 0x%x;", len);
+    printf("\n#endif // FORTH_TURNKEY");
     printf("\nconst uint32_t forth_rom[] PROGMEM = {\n");
-    for (int p=0; p<len+0x20; p+=0x20) {
-        U32 *x = (U32*)&rom[p];
-        for (int i=0; i<0x8; i++, x++) {
-            printf("0x%08x,", *x);
+    for (int p=0; p<code; p+=0x20) _dump_row(rom, p);        /// * code
+    printf("#if !FORTH_TURNKEY\n");
+    for (int p=code; p<len+0x20; p+=0x20) _dump_row(rom, p); /// * name space
+    printf("#endif // !FORTH_TURNKEY\n");
+    printf("};\n");
+}
+
+///
+/// create C functions for ROM words (AOT), one per word, subroutine threaded
+///   + primitives call the VM's inlined _X bodies (p_XXX)
+///   + branches are gotos, a colon call is a C call returning the ip to go on at
+///   + a return elsewhere (R> tricks, bail out) resumes at that op or is passed on
+///
+#undef  OP
+#define OP(name)    #name
+static const char *_opn[] = { "NOP", OPCODES };
+#define OP_N        ((int)(sizeof(_opn)/sizeof(_opn[0])))
+
+int _wfind(IU xt) {                           ///> index of word xt (-1: none)
+    for (int i=0; i<_wn; i++) if (_wxt[i]==xt) return i;
+    return -1;
+}
+void _jump(IU p, IU t, IU *op, int n) {       ///> branch at p to t
+    int k = 0;
+    while (k < n && op[k] != t) k++;
+    if (k == n)      printf("return 0x%x;", t);         /// * not an op of this word
+    else if (t <= p) printf("A_LOOP(0x%x, L%04x);", t, t);
+    else             printf("goto L%04x;", t);
+}
+void _aot_word(int w, IU end) {
+    static IU op[FORTH_ROM_SZ];               ///< op addresses of the word
+    static U8 tgt[FORTH_ROM_SZ];              ///< 1: branch target
+    IU  xt = _wxt[w];
+    int n  = 0, call = 0;
+    memset(tgt, 0, sizeof(tgt));
+    for (IU p = xt; p < end; ) {              /// * pass 1, op boundaries
+        if (_dat[p]) { p++; continue; }
+        U8 b = BGET(p);
+        op[n++] = p;
+        call |= (b & 0x80) || b==opEXECU;
+        U8 br = b==opBRAN || b==opQBRAN || b==opDONEXT || (b >= opDODO && b <= opDOPLOOP);
+        if (br) {
+            IU t = GET(p + 1);
+            if (t < FORTH_ROM_SZ) tgt[t] = 1;
+        }
+        p += (b & 0x80) ? CELLSZ
+           : b==opBYTE ? 2
+           : (b==opDOLIT || br) ? 1 + CELLSZ
+           : 1;
+    }
+    printf("\nIU a_%04x() {    /// : %s ;\n", xt, _wnm[w]);
+    if (call) printf("    IU ip;\n");
+    for (int i=0; i<n; i++) {                 /// * pass 2, an op per line
+        IU p = op[i];
+        U8 b = BGET(p);
+        if (call || tgt[p]) printf("L%04x: ", p);    /// * resume or branch target
+        else                printf("       ");
+        if (b & 0x80) {
+            IU c = b & 0x7f;                  /// * call token is high-byte first
+            for (int k=1; k < CELLSZ; k++) c = (c << 8) | BGET(p + k);
+            if (_wfind(c) < 0) printf("return 0x%x;", p);
+            else printf("A_CALL(0x%x, a_%04x);", p, c);
         }
-        printf(" // %04x ", p);
-        for (int i=0; i<0x20; i++) {
-            U8 c = rom[p+i];
-            printf("%c", c ? ((c!=0x5c && c>0x1f && c<0x7f) ? c : '_') : '.');
+        else switch (b) {
+        case opNOP:
+        case opENTER:  if (call || tgt[p]) printf(";"); break;
+        case opEXIT:   printf("A_EXIT(0x%x);", p); break;
+        case opBYTE:   printf("PUSH(0x%x);", BGET(p + 1)); break;
+        case opDOLIT:  printf("PUSH((DU)0x%x);", GET(p + 1)); break;
+        case opDOVAR:  printf("PUSH(0x%x);", p + 2); break;
+        case opEXECU:  printf("A_EXEC(0x%x);", p); break;
+        case opBRAN:   _jump(p, GET(p + 1), op, n); break;
+        case opQBRAN:
+            printf("if (!T) { POP(); "); _jump(p, GET(p + 1), op, n); printf(" } POP();");
+            break;
+        case opDONEXT:
+            printf("if (I-- > 0) { "); _jump(p, GET(p + 1), op, n); printf(" } RPOP();");
+            break;
+        case opBYE: case opDOES: case opQSTK:  /// * ip or ir bound, interpreter
+        case opDODO: case opDOLOOP: case opDOPLOOP: case opLEAVE:
+            printf("return 0x%x;", p); break;
+        default:
+            if (b < OP_N) printf("p_%s();", _opn[b]);
+            else          printf("return 0x%x;", p);
         }
         printf("\n");
     }
-    printf("};\n");
+    printf("    return 0x%x;\n", end);    /// * falls through to next word
+    if (call) {                               /// * return elsewhere
+        printf("resume:\n    switch (ip) {\n");
+        for (int i=0; i<n; i++) printf("    case 0x%x: goto L%04x;\n", op[i], op[i]);
+        printf("    }\n    return ip;\n");
+    }
+    printf("}\n");
+}
+void _dump_aot(U8* rom, int code)
+{
+    printf(
+        "///\n"
+        "/// @file eforth_aot.h\n"
+        "/// @brief eForth ROM words compiled ahead of time (generated with eforth_rom.c)\n"
+        "/// @attention not a standalone header, included by eforth_vm.cpp when AOT is set\n"
+        "///\n"
+        "#if CELLSZ != %d\n"
+        "#error \"eforth_aot.h is for another CELLSZ, make rom\"\n"
+        "#endif // CELLSZ\n", CELLSZ);
+    for (int w=0; w<_wn; w++) printf("IU a_%04x();\n", _wxt[w]);
+    for (int w=0; w<_wn; w++) _aot_word(w, w+1 < _wn ? _wxt[w+1] : code);
+    printf("\nIU aot_exec(IU xt) {\n    switch (xt) {\n");
+    for (int w=0; w<_wn; w++) printf("    case 0x%x: return a_%04x();\n", _wxt[w], _wxt[w]);
+    printf("    }\n    return xt;\n}\n");
 }
 
 #if !ARDUINO
-static U8 _rom[FORTH_ROM_SZ] = {};            ///< fake rom to simulate run time
+static U8 _rom[FORTH_ROM_SZ * 2] = {};        ///< fake rom to simulate run time (names past ROM in pass 1)
 int main(int ac, char* av[]) {
     setvbuf(stdout, NULL, _IONBF, 0);         /// * autoflush (turn STDOUT buffering off)
 
-    int sz = assemble(_rom);
-
-    _dump_rom(_rom, sz);
+    int sz = assemble(_rom, FORTH_ROM_SZ);    /// * pass 1, size of code
+    IU  nb = (sz + 0x1f) & ~0x1f;             /// * name space follows code (row aligned)
+    memset(_rom, 0, sizeof(_rom));
+    assemble(_rom, nb);                       /// * pass 2, headers after code
+    if (NP > FORTH_ROM_SZ) {
+        fprintf(stderr, "ROM max! 0x%x > 0x%x\n", NP, FORTH_ROM_SZ);
+        return 1;
+    }
+    if (ac > 1 && !strcmp(av[1], "-a")) _dump_aot(_rom, sz);  /// * AOT C functions
+    else _dump_rom(_rom, nb, NP);
 
     return 0;
 }
@@ -12,6 +12,7 @@
 #define ASM_TRACE       0          /** create assembler trace */
 #define CASE_SENSITIVE  0          /** enable case sensitive  */
 #define ENABLE_SEE      1          /** add SEE, +280 bytes    */
+#define WORD_MAX        512        /** words tracked for AOT  */
 ///
 /// Name field
 /// +----------+-------------+
@@ -19,6 +20,8 @@
 /// +----------+-------------+
 /// Forth name len max 31
 /// the following flags are used to flag word attributes
+/// (fHDR, in eforth_config.h, marks a header kept apart from its code,
+///  the name is followed by an xt cell)
 ///
 #define fCMPL           0x40       /**< compile only flag */
 #define fIMMD           0x80       /**< immediate flag    */
@@ -94,14 +97,30 @@ enum {
 ///@{
 #define BSET(d, c)  (_byte[d]=(U8)(c))
 #define BGET(d)     (_byte[d])
-#define SET(d, v)   do { U16 a=(d); U16 x=(v); BSET(a,(x)>>8); BSET((a)+1,(x)&0xff); } while (0)
-#define GET(d)      ({ U16 a=(d); ((U16)BGET(a)<<8) | BGET((a)+1); })
+#if MEM_NATIVE                     /** cell byte n at offset n (little-endian) */
+#define BOFF(n)     (n)
+#define BSWAP(x)    (CELLSZ==4 ? __builtin_bswap32(x) : __builtin_bswap16(x))
+#else  // !MEM_NATIVE              /** cell byte n at offset CELLSZ-1-n (big-endian) */
+#define BOFF(n)     (CELLSZ-1-(n))
+#define BSWAP(x)    (x)
+#endif // MEM_NATIVE
+#define SET(d, v)   do { IU a=(d); IU x=(v); for (int n=0; n<CELLSZ; n++, x>>=8) BSET(a+BOFF(n), x&0xff); } while (0)
+#define GET(d)      ({ IU a=(d); IU x=0; for (int n=CELLSZ-1; n>=0; n--) x=(x<<8)|BGET(a+BOFF(n)); x; })
 #define STORE(v)    do { SET(PC,(v)); PC+=CELLSZ; } while(0)
 #define RPUSH(a)    SET(FORTH_ROM_SZ - (++R)*CELLSZ, (a))             /** tail section of memory block */
-#define RPOP()      ((U16)GET(FORTH_ROM_SZ - (R ? R-- : R)*CELLSZ))
-#define VL(a, i)    (((U16)(a)+CELLSZ*(i))&0xff)
-#define VH(a, i)    (((U16)(a)+CELLSZ*(i))>>8)
-#define VAL(a, i)   opDOLIT,VH(a,i),VL(a,i),opEXIT
+#define RPOP()      ((IU)GET(FORTH_ROM_SZ - (R ? R-- : R)*CELLSZ))
+#define VB(a, i, n) ((((IU)(a)+CELLSZ*(i))>>(8*BOFF(n)))&0xff)        /** n-th ROM byte of uvar i */
+#if CELLSZ==4
+#define VAL(a, i)   opDOLIT,VB(a,i,0),VB(a,i,1),VB(a,i,2),VB(a,i,3),opEXIT
+#else  // CELLSZ==2
+#define VAL(a, i)   opDOLIT,VB(a,i,0),VB(a,i,1),opEXIT
+#endif // CELLSZ==4
+///
+/// colon word call token, always high-byte first (VM checks fCOLON8 on 1st byte)
+///
+#define STORE_XT(v) do { IU x=(v)|fCOLON; for (int n=CELLSZ-1; n>=0; n--) BSET(PC++, (x>>(8*n))&0xff); } while(0)
+#define XT_LIT(v)   ((IU)BSWAP((IU)((v)|fCOLON)))                   /** a cell which stores as a call token */
+#define NAME_MASK   (MEM_NATIVE ? 0xff1f : 0x1fff)   /**< 1st cell of name field, no flags */
 ///@}
 ///@defgroup Assembler macro
 ///@{
@@ -118,6 +137,7 @@ enum {
             continue;                           \
         }                                       \
         if (byte) {     /** 8-bit value */      \
+            DATA(PC, 1);                        \
             BSET(PC++, j);                      \
             DEBUG(" %02x", j);                  \
             byte = 0;                           \
@@ -132,8 +152,9 @@ enum {
             }                                   \
         }                                       \
         else {          /** colon words */      \
-          STORE(j | fCOLON16);                  \
+          STORE_XT(j);                          \
           DEBUG(" %04x", j);                    \
+          byte = (j==COMPIP); /** inline op */  \
         }                                       \
     }                                           \
     va_end(argList);                            \
@@ -146,9 +167,9 @@ enum {
 }
 
 #define OPSTR(ip, seq) {                        \
-    SET(PC, ip | fCOLON16);                     \
-    PC += CELLSZ;                               \
+    STORE_XT(ip);                               \
     int len = strlen(seq);                      \
+    DATA(PC, len + 1);                          \
     BSET(PC++, len);                            \
     MEMCPY(len, seq);                           \
 }
@@ -156,10 +177,20 @@ enum {
 ///@defgroup Assembler Module variables
 ///@{
 extern IU PC;          ///< assembler program counter
+extern IU NP;          ///< assembler name space pointer
 extern U8 R;           ///< assembler return stack index
 extern IU _link;       ///< link to previous word
 extern U8 *_byte;      ///< assembler byte array (heap)
 extern IU DOTQP;       ///< addr of output function _dotq
+extern IU COMPIP;      ///< addr of COMPILE, an inline opcode byte follows its call
+///
+///> word table and inline data map, for the AOT compiler
+///
+extern int _wn;                  ///< number of words
+extern IU  _wxt[WORD_MAX];       ///< xt of each word, in code space order
+extern const char *_wnm[WORD_MAX]; ///< name of each word
+extern U8  _dat[FORTH_ROM_SZ];   ///< 1: inline data byte, not an op
+#define DATA(a, n)  memset(&_dat[a], 1, (n))
 ///
 ///@defgroup Pseudo macros (to handle va_list)
 ///@brief - keeping functions in the header is considered a bad practice!
@@ -187,18 +218,26 @@ void _rdump()                            ///> dump return stack
 ///
 ///> create a word hearder
 ///
-void _header(int lex, const char *seq) { /// create a word header in dictionary
+void _header(int lex, const char *seq) { /// create a word header in ROM name space
     if (_link) {
         if (PC >= FORTH_ROM_SZ) DEBUG("ROM %s", "max!");
-        _dump(_link - sizeof(IU), PC);   /// * dump data from previous word to current word
+        _dump(GET(_link + 1 + (BGET(_link) & 0x1f)), PC);  /// * dump code of previous word
     }
-    STORE(_link);                        /// * point to previous word
-    _link = PC;                          /// * keep pointer to this word
+    SET(NP, _link);                      /// * point to previous word
+    NP += CELLSZ;
+    _link = NP;                          /// * keep pointer to this word
 
-    BSET(PC++, lex);                     /// * length of word (with optional fIMMED or fCOMPO flags)
+    BSET(NP++, lex | fHDR);              /// * length of word (with optional fIMMED or fCOMPO flags)
     int len = lex & 0x1f;                /// * Forth allows word max length 31
     
-    MEMCPY(len, seq);                    /// * memcpy word string
+    memcpy(&_byte[NP], seq, len);        /// * memcpy word string
+    NP += len;
+    SET(NP, PC);                         /// * xt, code stays in code space
+    NP += CELLSZ;
+    if (_wn < WORD_MAX) {                /// * keep xt and name for AOT
+        _wxt[_wn]   = PC;
+        _wnm[_wn++] = seq;
+    }
     DEBUG("\n%04x: ", PC);
     DEBUG("%s", seq);
 }
@@ -15,35 +15,94 @@
 
 #define APP_NAME      "eForth1 v2.6"
 #define USE_RAW_UART  0               /** default, use Serail interface */
+#ifndef FORTH_TURNKEY
+#define FORTH_TURNKEY 0               /** 1: ROM names stripped, boot LOADs EEPROM and runs 'BOOT */
+#endif // FORTH_TURNKEY
+#ifndef CELLSZ
+#define CELLSZ        2               /** 2: 16-bit cell/address, 4: 32-bit (make CELLSZ=4) */
+#endif // CELLSZ
+#ifndef MEM_NATIVE
+#define MEM_NATIVE    (CELLSZ==4)     /** 1: native-endian cells, flat memory on host (reassemble ROM) */
+#endif // MEM_NATIVE
+#if MEM_NATIVE && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#error "MEM_NATIVE assumes a little-endian target"
+#endif
+#if !ARDUINO || (MEM_NATIVE && !defined(__AVR__))
+#define MEM_FLAT      1               /** ROM copied in front of RAM, one flat address space */
+#else
+#define MEM_FLAT      0
+#endif
+#if CELLSZ==4 && !(MEM_FLAT && MEM_NATIVE)
+#error "32-bit cells need the native-endian flat memory model (MEM_NATIVE on a non-AVR target)"
+#endif
 ///
 ///@name Portable Types
 ///@{
+typedef uint64_t  U64;                ///< 64-bit unsigned integer
 typedef uint32_t  U32;                ///< 32-bit unsigned integer
 typedef uint16_t  U16;                ///< 16-bit unsigned integer
 typedef uint8_t   U8;                 ///< 8-bit unsigned integer
 
+typedef int64_t   S64;                ///< 64-bit signed integer
 typedef int32_t   S32;                ///< 32-bit signed integer
 typedef int16_t   S16;                ///< 16-bit signed integer
 typedef int8_t    S8;                 ///< 8-bit signed integer
 
+#if CELLSZ==4
+typedef U32       IU;                 ///< instruction/address unit (32-bit)
+typedef S32       DU;                 ///< data/cell unit
+typedef U32       UDU;                ///< unsigned cell
+typedef S64       DU2;                ///< double cell
+typedef U64       UDU2;               ///< unsigned double cell
+#else  // CELLSZ==2
 typedef U16       IU;                 ///< instruction/address unit (16-bit)
 typedef S16       DU;                 ///< data/cell unit
+typedef U16       UDU;                ///< unsigned cell
+typedef S32       DU2;                ///< double cell
+typedef U32       UDU2;               ///< unsigned double cell
+#endif // CELLSZ==4
+#define CELL_BITS (CELLSZ*8)          /**< bits per cell */
 typedef void (*CFP)();                ///< function pointer
 ///@}
 ///
 ///@name Capacity and Sizing
-///@attention reassemble ROM needed if FORTH_TIB_SZ or FORTH_PAD_SZ changed
+///@note RAM and TIB sizes are defaults, vm_init can take others (ROM unchanged)
 ///@{
-#define CELLSZ           2            /**< 16-bit cell size                    */
 #define CFUNC_MAX        8            /**< size C function pointer slots (8)   */
+#define TASK_MAX         4            /**< max Forth tasks (task 0 is main)    */
+#define SCHED_MAX        4            /**< max deadline scheduled jobs         */
+#define ORDER_MAX        8            /**< max wordlists in search order       */
 #define FORTH_ROM_SZ     0x2000       /**< size of ROM (for pre-defined words) */
-#define FORTH_UVAR_SZ    0x20         /**< size of Forth user variables        */
+#if CELLSZ==4
+#define FORTH_UVAR_SZ    0x80         /**< size of Forth user variables        */
+#define FORTH_DIC_SZ     (0x10000-FORTH_UVAR_SZ) /**< size of dictionary space */
+#define FORTH_DSTK_SZ    0x100        /**< size of data stack                  */
+#define FORTH_RSTK_SZ    0x100        /**< size of return stack                */
+#define FORTH_ISTK_SZ    0x80         /**< size of ISR data/return stack       */
+#define FORTH_MEM_SZ     0x20000      /**< flat address space (power of 2)     */
+#define FORTH_RAM_MAX    (FORTH_MEM_SZ - FORTH_ROM_SZ) /**< flat model RAM limit */
+#else  // CELLSZ==2
+#define FORTH_UVAR_SZ    0x40         /**< size of Forth user variables        */
 #define FORTH_DIC_SZ     (0x400-FORTH_UVAR_SZ) /**< size of dictionary space   */
-#define FORTH_STACK_SZ   0x80         /**< size of data/return stack           */
+#define FORTH_DSTK_SZ    0x40         /**< size of data stack                  */
+#define FORTH_RSTK_SZ    0x40         /**< size of return stack                */
+#define FORTH_ISTK_SZ    0x20         /**< size of ISR data/return stack       */
+#define FORTH_MEM_SZ     0x10000      /**< flat address space (power of 2)     */
+#define FORTH_RAM_MAX    (0x8000 - FORTH_ROM_SZ) /**< flat RAM limit, colon words below fCOLON */
+#endif // CELLSZ==4
 #define FORTH_TIB_SZ     0x80         /**< size of terminal input buffer       */
+#define FORTH_POOL_BLK   (8*CELLSZ)   /**< ALLOCATE pool block size (power of 2) */
+#define FORTH_INLINE_SZ  (CELLSZ+2)   /**< auto-inlined colon body, max bytes   */
+#define FORTH_INLINE_MAX 0x80         /**< INLINE flagged body, max bytes      */
+#if ARDUINO
+#define FORTH_HEAP_SZ    0            /**< no default heap, see HEAP           */
+#else  // !ARDUINO
+#define FORTH_HEAP_SZ    0x1000       /**< heap below the stacks (ALLOCATE)    */
+#endif // ARDUINO
 #define FORTH_RAM_SZ     ( \
-     FORTH_UVAR_SZ + FORTH_DIC_SZ + \
-     FORTH_STACK_SZ + FORTH_TIB_SZ)   /**< total RAM allocated                 */
+     FORTH_UVAR_SZ + FORTH_DIC_SZ + FORTH_HEAP_SZ + \
+     FORTH_DSTK_SZ + FORTH_RSTK_SZ + FORTH_ISTK_SZ + \
+     FORTH_TIB_SZ)                    /**< total RAM allocated                 */
 ///@}
 ///
 ///> note:
@@ -58,9 +117,12 @@ typedef void (*CFP)();                ///< function pointer
 #define FORTH_RAM_ADDR   FORTH_ROM_SZ
 #define FORTH_UVAR_ADDR  FORTH_RAM_ADDR
 #define FORTH_DIC_ADDR   (FORTH_UVAR_ADDR + FORTH_UVAR_SZ)
-#define FORTH_STACK_ADDR (FORTH_DIC_ADDR  + FORTH_DIC_SZ)
-#define FORTH_STACK_TOP  (FORTH_STACK_ADDR + FORTH_STACK_SZ)
-#define FORTH_TIB_ADDR   (FORTH_STACK_TOP)
+#define FORTH_HEAP_ADDR  (FORTH_DIC_ADDR  + FORTH_DIC_SZ)
+#define FORTH_DSTK_ADDR  (FORTH_HEAP_ADDR + FORTH_HEAP_SZ)
+#define FORTH_RSTK_ADDR  (FORTH_DSTK_ADDR + FORTH_DSTK_SZ)
+#define FORTH_ISTK_ADDR  (FORTH_RSTK_ADDR + FORTH_RSTK_SZ)
+#define FORTH_ISTK_TOP   (FORTH_ISTK_ADDR + FORTH_ISTK_SZ)
+#define FORTH_TIB_ADDR   (FORTH_ISTK_TOP)
 #define FORTH_MAX_ADDR   (FORTH_TIB_ADDR + FORTH_TIB_SZ)
 ///@}
 ///
@@ -73,7 +135,8 @@ typedef void (*CFP)();                ///< function pointer
 ///@}
 ///@name VM operational flags
 ///@{
-#define fCOLON16        0x8000       /**< 16-bit flag, colon word */
+#define fCOLON          ((IU)1<<(CELL_BITS-1)) /**< cell flag, colon word  */
 #define fCOLON8         0x80         /**< 8-bit flag (high-byte)  */
+#define fHDR            0x20         /**< name flag, separated header (xt follows name) */
 ///@}
 #endif // __EFORTH_CONFIG_H
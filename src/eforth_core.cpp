@@ -3,20 +3,64 @@
  * @brief eForth core controller module
  */
 #include "eforth_core.h"
+#if ARDUINO
+typedef volatile U8 HIT8;            ///< captured by hardware ISR
+#else  // !ARDUINO
+#include <atomic>
+#include <thread>
+#include <chrono>
+typedef std::atomic<U8> HIT8;        ///< captured by simulator thread
+#endif // ARDUINO
 //
 /// interrupt handlers
 ///
 typedef struct {
-    U16 xt[11];                      ///< interrupt vectors 0-7: timer, 8-10: pin change
+    IU  xt[11];                      ///< interrupt vectors 0-7: timer, 8-10: pin change
     U16 t_max[8];                    ///< timer CTC top value
     U8  t_idx { 0 };                 ///< timer ISR index
     volatile U16 t_cnt[8];           ///< timer CTC counters
-    volatile U8  t_hit { 0 };        ///< 8-bit for 8 timer ISR
-    volatile U8  p_hit { 0 };        ///< pin change interrupt (PORT-B,C,D)
+    HIT8 t_hit { 0 };                ///< 8-bit for 8 timer ISR
+    HIT8 p_hit { 0 };                ///< pin change interrupt (PORT-B,C,D)
 } IsrRec;
 
 IsrRec ir;                           ///< interrupt state management
 ///
+/// ISR latency, from flag raised (in ISR) to xt dispatched (by intr_service)
+/// and, for deadline jobs (vector 11), from due time to dispatch (in whole ms)
+///
+#if ISR_LATENCY
+#define LAT_BKT      8               /** histogram buckets, k: < 32us << k */
+#define LAT_VEC      12              /** 0-7 timer, 8-10 pin change, 11 deadline jobs */
+typedef struct {
+    volatile U32 t_raise[11];        ///< time flag raised (us), by ISR
+    U32 t_cap[11];                   ///< raise time of cached flags
+    U32 max[LAT_VEC];                ///< max latency (us)
+    U16 hist[LAT_VEC][LAT_BKT];      ///< latency histogram
+} LatRec;
+
+LatRec lat;                          ///< latency statistics
+#define LAT_RAISE(v, f, b)  if (!((f) & (b))) lat.t_raise[v] = micros()
+void _lat_add(U8 v, U32 d) {         ///> count latency d (us) of vector v
+    U8 k = 0;
+    for (U32 n = d >> 5; n && k < LAT_BKT-1; n >>= 1) k++;
+    if (lat.hist[v][k] < 0xffff) lat.hist[v][k]++;
+    if (d > lat.max[v]) lat.max[v] = d;
+}
+#else  // !ISR_LATENCY
+#define LAT_RAISE(v, f, b)
+#endif // ISR_LATENCY
+///
+/// deadline scheduled jobs (kept sorted, earliest first)
+///
+typedef struct {
+    U32 due;                         ///< next run time (in CLOCK ms)
+    U16 period;                      ///< repeat period in ms, 0: one-shot
+    IU  xt;                          ///< job to run
+} JobRec;
+
+JobRec job[SCHED_MAX];               ///< job queue
+U8     job_n = 0;                    ///< number of jobs queued
+///
 ///> reset interrupt states
 ///
 void intr_reset() {
@@ -26,30 +70,68 @@ void intr_reset() {
     ir.t_idx = ir.t_hit = ir.p_hit = 0;
     for (U8 i=0; i < 11; i++) ir.xt[i] = 0;
     SEI();
+    job_n = 0;
+    intr_latency_reset();
+}
+///
+///> pin change flagged, b: PORT-B=1, C=2, D=4 (called in interrupt context)
+///
+inline void _pci_hit(U8 b) {
+    LAT_RAISE(b==1 ? 8 : (b==2 ? 9 : 10), ir.p_hit, b);
+    ir.p_hit |= b;
 }
 
-#if ARDUINO
-#define _fake_intr(hits)
-#else // !ARDUINO
-U8  tmr_on = 0;                   ///< fake timer enabler
-void _fake_intr(U8 hits)
-{
-    static int n = 0;                              // fake interrupt
-    if (tmr_on && !hits && ++n >= 100) {
-        n=0; ir.t_hit = 3;
+///
+///> 1ms timer tick, count down timer ISRs (called in interrupt context)
+///
+inline void _timer_tick() {
+    for (U8 i=0, b=1; i < ir.t_idx; i++, b<<=1) {
+        if (!ir.xt[i] || (++ir.t_cnt[i] < ir.t_max[i])) continue;
+        LAT_RAISE(i, ir.t_hit, b);
+        ir.t_hit    |= b;
+        ir.t_cnt[i]  = 0;
     }
 }
-#endif // ARDUINO
+///
+///> insert a job into the queue by its due time
+///
+void _job_push(IU xt, U32 due, U16 period) {
+    if (job_n >= SCHED_MAX) return;                /// * queue full
+    U8 i = job_n++;
+    for (; i && (S32)(job[i-1].due - due) > 0; i--) {
+        job[i] = job[i-1];                         /// * make room for the new job
+    }
+    job[i].due    = due;
+    job[i].period = period;
+    job[i].xt     = xt;
+}
+///
+///> pop the head job if its deadline passed, repeating jobs are requeued
+///
+IU _job_due() {
+    if (!job_n || (S32)(millis() - job[0].due) < 0) return 0;
+
+    JobRec j = job[0];
+    for (U8 i=1; i < job_n; i++) job[i-1] = job[i];
+    job_n--;
+#if ISR_LATENCY
+    _lat_add(11, (millis() - j.due) * 1000UL);     /// * late by, ms resolution
+#endif // ISR_LATENCY
+    if (j.period) {                                /// * next due from the last due
+        U32 now = millis();                        /// * not from now, so no drift
+        do { j.due += j.period; } while ((S32)(now - j.due) >= 0); /// * skip missed slots
+        _job_push(j.xt, j.due, j.period);
+    }
+    return j.xt;
+}
 ///
 ///> service interrupt routines
 ///
 #define YIELD_PERIOD 50      /** 256 max (1ms ~ 50*20us/op) */
+volatile static U16 hits = 0;                      ///> cached interrupt flags
 IU intr_service() {
-    volatile static U16 hits = 0;                  ///> cached interrupt flags
 	static U8 cnt = 0;                             ///> throttle counter
 
-    _fake_intr(hits);                              /// * on x86 platform
-
     if (!hits && ++cnt < YIELD_PERIOD) return 0;   /// * throttle down (boot performance a bit)
     cnt = 0;                                       /// * reset throttle counter
 
@@ -57,20 +139,54 @@ IU intr_service() {
     if (!hits) {
         hits = ((U16)ir.p_hit << 8) | ir.t_hit;    // cache interrupt flags
         ir.p_hit = ir.t_hit = 0;                   // clear captured interrupts
+#if ISR_LATENCY
+        for (U8 i=0; hits >> i; i++) {             // keep raise time of cached flags
+            if (hits & (1 << i)) lat.t_cap[i] = lat.t_raise[i];
+        }
+#endif // ISR_LATENCY
     }
     SEI();
-    for (U8 i=0; hits; i++, hits>>=1) {            // serve interrupts (hopefully fairly)
-		if (hits & 1) {                            // check interrupt flag
-			hits >>= 1;                            // clear flag
+    for (U8 i=0; hits >> i; i++) {                 // serve interrupts (hopefully fairly)
+		if (hits & (1 << i)) {                     // check interrupt flag
+			hits &= ~(1 << i);                     // clear flag
+#if ISR_LATENCY
+            _lat_add(i, micros() - lat.t_cap[i]);  // latency in us
+#endif // ISR_LATENCY
 			return ir.xt[i];                       // return ISR to Forth VM
 		}
     }
+    return _job_due();                             // deadline jobs
+}
+///
+///> interrupts waiting, bit 0-7: timer, 8-10: pin change, 15: deadline job due
+///
+U16 intr_hits() {
+    U16 h = hits | ((U16)ir.p_hit << 8) | ir.t_hit;
+    if (job_n && (S32)(millis() - job[0].due) >= 0) h |= 0x8000;
+    return h;
+}
+///
+///> ISR v latency, b: histogram bucket (< 32us << b), or LAT_BKT: max in us
+///
+U16 intr_latency(U8 v, U8 b) {
+#if ISR_LATENCY
+    if (v >= LAT_VEC) return 0;
+    if (b < LAT_BKT) return lat.hist[v][b];
+    return lat.max[v] > 0xffff ? 0xffff : (U16)lat.max[v];
+#else  // !ISR_LATENCY
     return 0;
+#endif // ISR_LATENCY
+}
+void intr_latency_reset() {
+#if ISR_LATENCY
+    memset(lat.max,  0, sizeof(lat.max));
+    memset(lat.hist, 0, sizeof(lat.hist));
+#endif // ISR_LATENCY
 }
 ///
 ///> add timer interrupt service routine
 ///
-void intr_add_tmisr(U8 i, U16 ms, U16 xt) {
+void intr_add_tmisr(U8 i, U16 ms, IU xt) {
     if (xt==0 || i > 7) return; // range check
 
     CLI();
@@ -80,11 +196,58 @@ void intr_add_tmisr(U8 i, U16 ms, U16 xt) {
     if (i >= ir.t_idx) ir.t_idx = i + 1;
     SEI();
 }
+///
+///> schedule xt at absolute time due (ms), then every period ms (0: once)
+///
+void intr_add_job(IU xt, U32 due, U16 period) {
+    if (xt==0) return;                  // range check
+    intr_del_job(xt);                   // one schedule per xt
+    _job_push(xt, due, period);
+}
+///
+///> remove xt from the job queue
+///
+void intr_del_job(IU xt) {
+    U8 n = 0;
+    for (U8 i=0; i < job_n; i++) {
+        if (job[i].xt != xt) job[n++] = job[i];
+    }
+    job_n = n;
+}
+///
+///> save (load=0) or restore (load=1) ISR vectors, jobs and enables at p, returns end of image
+///
+#define EN_SZ  5                        /**< timer and pin change enables */
+void _en_get(U8 *e);
+void _en_set(U8 *e);
+static U8 *_snap(U8 *p, void *x, U16 n, U8 load) {
+    if (load) memcpy(x, p, n);
+    else      memcpy(p, x, n);
+    return p + n;
+}
+U8 *intr_snap(U8 *p, U8 load) {
+    U8 e[EN_SZ] = { 0 };
+    if (!load) _en_get(e);
+    CLI();
+    p = _snap(p, e,        EN_SZ,            load);
+    p = _snap(p, ir.xt,    sizeof(ir.xt),    load);
+    p = _snap(p, ir.t_max, sizeof(ir.t_max), load);
+    p = _snap(p, &ir.t_idx, 1,               load);
+    p = _snap(p, job,      sizeof(job),      load);
+    p = _snap(p, &job_n,   1,                load);
+    if (load) {                         // drop pending hits of old vectors
+        ir.t_hit = ir.p_hit = 0;
+        for (U8 i=0; i < 8; i++) ir.t_cnt[i] = 0;
+    }
+    SEI();
+    if (load) _en_set(e);               // outside CLI, enablers lock on their own
+    return p;
+}
 #if ARDUINO
 ///
 ///> add pin change interrupt service routine
 ///
-void intr_add_pcisr(U8 p, U16 xt) {
+void intr_add_pcisr(U8 p, IU xt) {
     if (xt==0) return;              // range check
     CLI();
     if (p < 8)       {
@@ -127,30 +290,94 @@ void intr_timer_enable(U8 f) {
         TIMSK2 |= _BV(OCIE2A);             // enable timer2 compare interrupt
     }
     else {
-        TIMSK2 &= _BV(OCIE2A);             // disable timer2 compare interrupt
+        TIMSK2 &= ~_BV(OCIE2A);            // disable timer2 compare interrupt
     }
     SEI();
 }
 ///
-///> Arduino interrupt service routines
+///> interrupt enables for MARKER, [timer][PCICR][PCMSK0..2]
 ///
-ISR(TIMER2_COMPA_vect) {
-    for (U8 i=0, b=1; i < ir.t_idx; i++, b<<=1) {
-        if (!ir.xt[i] || (++ir.t_cnt[i] < ir.t_max[i])) continue;
-        ir.t_hit    |= b;
-        ir.t_cnt[i]  = 0;
-    }
+void _en_get(U8 *e) {
+    e[0] = (TIMSK2 & _BV(OCIE2A)) ? 1 : 0;
+    e[1] = PCICR;
+    e[2] = PCMSK0; e[3] = PCMSK1; e[4] = PCMSK2;
 }
-ISR(PCINT0_vect) { ir.p_hit |= 1; }
-ISR(PCINT1_vect) { ir.p_hit |= 2; }
-ISR(PCINT2_vect) { ir.p_hit |= 4; }
+void _en_set(U8 *e) {
+    CLI();
+    PCMSK0 = e[2]; PCMSK1 = e[3]; PCMSK2 = e[4];
+    PCICR  = e[1];
+    SEI();
+    intr_timer_enable(e[0]);
+}
+///
+///> Arduino interrupt service routines
+///
+ISR(TIMER2_COMPA_vect) { _timer_tick(); }
+ISR(PCINT0_vect) { _pci_hit(1); }
+ISR(PCINT1_vect) { _pci_hit(2); }
+ISR(PCINT2_vect) { _pci_hit(4); }
 
 #else // !ARDUINO
+///
+///> host interrupt simulator
+///> * a thread ticks _timer_tick() from a monotonic 1ms clock
+///> * pin changes are injected from a script of "ms:pin,ms:pin,..."
+///> * CLI/SEI is a spinlock, so the thread never ticks in a critical section
+///
+typedef std::chrono::steady_clock SimClock;
+SimClock::time_point  sim_t0 = SimClock::now();     ///< host epoch for millis()
+std::atomic_flag      sim_lock = ATOMIC_FLAG_INIT;  ///< CLI/SEI lock
+std::atomic<U8>       tmr_on { 0 };                 ///< timer2 enabler
+std::atomic<U8>       pci_on { 0 };                 ///< pin change enabler
+U8                    pci_msk = 0;                  ///< ports with PCISR
 
-void intr_add_pcisr(U8 p, U16 xt) {}        // mocked functions for x86
-void intr_pci_enable(U8 f)        {}
-void intr_timer_enable(U8 f) {
-    tmr_on = f;
+U32  millis() {
+    return (U32)std::chrono::duration_cast<std::chrono::milliseconds>(
+        SimClock::now() - sim_t0).count();
+}
+U32  micros() {
+    return (U32)std::chrono::duration_cast<std::chrono::microseconds>(
+        SimClock::now() - sim_t0).count();
+}
+void intr_cli() { while (sim_lock.test_and_set(std::memory_order_acquire)); }
+void intr_sei() { sim_lock.clear(std::memory_order_release); }
+
+U8 _pci_port(U8 p) {                            ///< pin => p_hit bit (B=1, C=2, D=4)
+    return p < 8 ? 4 : (p < 14 ? 1 : 2);
+}
+void _sim_run(const char *pci) {
+    U32 ms = millis();                          ///< ticks served so far
+    char *p = (char*)pci;
+    U32 t_pci = p ? (U32)strtoul(p, &p, 10) : 0;    /// * first scripted event
+    while (1) {
+        std::this_thread::sleep_until(sim_t0 + std::chrono::milliseconds(ms + 1));
+        for (U32 now = millis(); ms < now; ms++) {  /// * catch up if thread was late
+            intr_cli();
+            if (tmr_on) _timer_tick();
+            intr_sei();
+        }
+        while (p && *p == ':' && t_pci <= ms) {     /// * inject pin changes due
+            U8 b = _pci_port((U8)strtoul(p + 1, &p, 10));
+            if (pci_on & b) _pci_hit(b);
+            t_pci = (*p == ',') ? (U32)strtoul(p + 1, &p, 10) : 0;
+            if (!t_pci) p = NULL;                   /// * end of script
+        }
+    }
+}
+void intr_sim_start(const char *pci) {
+    std::thread(_sim_run, pci).detach();
+}
+void intr_add_pcisr(U8 p, IU xt) {
+    if (xt==0) return;
+    U8 b = _pci_port(p);
+    CLI();
+    ir.xt[b==1 ? 8 : (b==2 ? 9 : 10)] = xt;
+    pci_msk |= b;
+    SEI();
 }
+void intr_pci_enable(U8 f)   { pci_on = f ? pci_msk : 0; }
+void intr_timer_enable(U8 f) { tmr_on = f; }
+void _en_get(U8 *e) { e[0] = tmr_on; e[1] = pci_on; e[2] = pci_msk; }
+void _en_set(U8 *e) { tmr_on = e[0]; pci_on = e[1]; pci_msk = e[2]; }
 
 #endif // ARDUINO
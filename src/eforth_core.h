@@ -9,7 +9,36 @@
 ///@name Compiler options
 ///@{
 #define EXE_TRACE     0  /**< VM execution tracing flag */
+#ifndef COMPUTED_GOTO
 #define COMPUTED_GOTO 0  /**< dispatcher (~5% faster, +180 bytes RAM) */
+#endif // COMPUTED_GOTO
+#ifndef TAIL_CALL
+#define TAIL_CALL     0  /**< dispatcher, handlers tail-call the next (host, -O2) */
+#endif // TAIL_CALL
+#ifndef XLAT_CACHE
+#define XLAT_CACHE    0  /**< translation cache, ops pre-decoded with operands (flat memory) */
+#endif // XLAT_CACHE
+#if XLAT_CACHE && !MEM_FLAT
+#error "XLAT_CACHE needs the flat memory model"
+#endif
+#ifndef JIT_X64
+#define JIT_X64       0  /**< template JIT, colon words to native code (x86-64 host) */
+#endif // JIT_X64
+#if JIT_X64 && (ARDUINO || !defined(__x86_64__))
+#error "JIT_X64 needs an x86-64 host"
+#endif
+#ifndef AOT
+#define AOT           0  /**< ROM words compiled ahead of time to C (eforth_aot.h, by make rom) */
+#endif // AOT
+#if AOT && JIT_X64
+#error "AOT and JIT_X64 are exclusive"
+#endif
+#ifndef ISR_LATENCY
+#define ISR_LATENCY   !ARDUINO /**< ISR latency histogram (+330 bytes RAM) */
+#endif // ISR_LATENCY
+#ifndef STACK_GUARD
+#define STACK_GUARD   !ARDUINO /**< stack bounds check on every colon call */
+#endif // STACK_GUARD
 ///@}
 ///@name Arduino Support Macros
 ///@{
@@ -38,7 +67,8 @@ typedef const char          *PGM_P;
 #define StreamIO            char
 #define pgm_read_byte(b)    *((U8*)(b))
 #define PROGMEM
-#define millis()            ((U32)clock())
+U32  millis();              ///< monotonic ms, from simulator clock
+U32  micros();              ///< monotonic us, from simulator clock
 #define pinMode(a,b)
 #define digitalRead(p)      (0)
 #define digitalWrite(p,v)
@@ -48,11 +78,14 @@ typedef const char          *PGM_P;
 #define LOG(s)              printf("%s", (s))
 #define LOG_C(c)            printf("%c", (c))
 #define LOG_V(s, n)         printf("%s%d", (s), (n))
-#define LOG_H(s, n)         printf("%s%x", (s), (U16)((n)&0xffff))
+#define LOG_H(s, n)         printf("%s%x", (s), (UDU)(n))
 #define LOW                 (0)
 #define HIGH                (1)
-#define CLI()
-#define SEI()
+#define CLI()               intr_cli()
+#define SEI()               intr_sei()
+void intr_cli();            ///< simulator lock (in place of cli)
+void intr_sei();            ///< simulator unlock (in place of sei)
+void intr_sim_start(const char *pci);  ///< start interrupt simulator thread
 
 #endif // ARDUINO
 
@@ -64,6 +97,11 @@ U16  intr_hits();
 IU   intr_service();
 void intr_add_tmisr(U8 i, U16 ms, IU xt);
 void intr_add_pcisr(U8 pin, IU xt);
+void intr_add_job(IU xt, U32 due, U16 period);
+void intr_del_job(IU xt);
+U8   *intr_snap(U8 *p, U8 load);
+U16  intr_latency(U8 v, U8 b);
+void intr_latency_reset();
 void intr_timer_enable(U8 f);
 void intr_pci_enable(U8 f);
 ///@}
@@ -73,7 +111,11 @@ void vm_init(
     PGM_P rom,              ///< pointer to Arduino flash memory block (ROM)
     U8    *ram,             ///< pointer to Arduino RAM block (RAM)
     void  *io_stream,       ///< pointer to Stream object of Arduino
-	const char *code        ///< embeded Forth code
+	const char *code,       ///< embeded Forth code
+    IU    ram_sz=FORTH_RAM_SZ,  ///< size of RAM block
+    IU    tib_sz=FORTH_TIB_SZ,  ///< size of terminal input buffer (top of RAM)
+    IU    ds_sz=FORTH_DSTK_SZ,  ///< size of data stack
+    IU    rs_sz=FORTH_RSTK_SZ   ///< size of return stack
     );
 void vm_outer();            ///< Forth outer interpreter
 ///@}
@@ -0,0 +1,508 @@
+/**
+ * @file
+ * @brief eForth x86-64 template JIT (host only)
+ *
+ * A colon word is compiled on its first call by stitching per-opcode
+ * machine code templates. VM registers stay in x86 registers while it runs
+ *   rbx: S, r12: T, r13: R, r14: I, rbp: VM memory, r15: poll countdown
+ * Native code keeps the VM stacks exactly as the interpreter would, and
+ * every way out returns the ip to resume at, so the interpreter can take
+ * over at any op boundary:
+ *   + words with ops not in the templates (EXECUTE, DOES>, IO, ...) are not compiled
+ *   + a call to a word not compiled (yet), or close to a stack fault
+ *   + interrupt or deadline job pending (polled on back branches)
+ *   + a store dropped native code (self-modifying dictionary writes)
+ *   + EXIT into an ISR or task return frame
+ */
+#include "eforth_jit.h"
+#if JIT_X64
+#include <sys/mman.h>
+#include "eforth_opcode.h"
+
+namespace EfVM {
+///
+///@name VM state (eforth_vm.cpp)
+///@{
+extern DU    *S, *R, T, I;
+extern DU    *SP0, *SPZ;
+extern PGM_P _rom;
+extern U16   _qmax;
+void  _jset(IU a, DU v, U8 b);       ///< SET, BSET or +! with cache invalidation
+///@}
+#define OP(name) op##name
+enum { opNOP = 0, OPCODES };
+#undef OP
+
+#define JIT_CODE_SZ  0x100000        /**< native code buffer (flushed when full) */
+#define JIT_WORDS    2048            /**< compiled words tracked */
+#define JIT_OPS      1024            /**< longest colon word compiled (in ops) */
+#define JIT_POLL     1024            /**< back branches between interrupt polls */
+#define NONE         ((void*)1)      /**< _jfn mark, word is interpreted */
+#define IRET_FLAG    fCOLON          /**< interrupt return flag, as in eforth_vm.h */
+///
+///@name Native Code Cache
+///@{
+typedef struct {
+    IU    ip;          ///< VM address of op
+    IU    arg;         ///< literal, branch target or callee xt
+    U8    op;          ///< opcode, colon call as ENTER
+    U8    *pc;         ///< native code of op
+} Ins;
+typedef struct {
+    IU    xt, end;     ///< VM code compiled, [xt, end]
+} Word;
+U8    *_code;          ///< code buffer, the entry thunk first
+U8    *_code0;         ///< first compiled word
+U8    *_pc;            ///< code emit pointer
+IU    (*_run)(void*);  ///< entry thunk, loads VM registers and calls a word
+void  *_jfn[FORTH_MEM_SZ]; ///< native code by xt (0: not tried, NONE: interpreted)
+U8    _jcov[FORTH_MEM_SZ]; ///< VM bytes covered by native code
+Word  _jw[JIT_WORDS];  ///< compiled words
+int   _jn;             ///< number of compiled words
+U8    _dirty;          ///< native code dropped by a store
+Ins   _ins[JIT_OPS];   ///< ops of word being compiled
+///@}
+///
+///> VM memory read by the compiler (flat model)
+///
+U8 _bget(IU a) { return ((U8*)_rom)[a & (FORTH_MEM_SZ-1)]; }
+IU _get(IU a) {
+#if MEM_NATIVE
+    IU v; memcpy(&v, &_rom[a & (FORTH_MEM_SZ-1)], sizeof(IU)); return v;
+#else  // !MEM_NATIVE
+    return ((IU)_bget(a) << 8) | _bget(a + 1);
+#endif // MEM_NATIVE
+}
+///
+///> called from native code
+///
+U8 _store(IU a, DU v, U8 b) {        ///> store, 1: native code dropped
+    _dirty = 0;
+    _jset(a, v, b);
+    return _dirty;
+}
+U32 _poll() {                        ///> 1: leave for the interpreter
+    return _qmax || intr_hits();
+}
+void *_lazy(IU xt);                  ///< compile callee from native code
+///
+///> x86-64 encoder
+///
+enum { rAX=0, rCX, rDX, rBX, rSP, rBP, rSI, rDI, R12=12, R13, R14, R15 };
+enum { cB=2, cAE, cE, cNE, cBE, cA, cL=0xc, cGE, cLE, cG };
+
+void _b(U8 b)   { *_pc++ = b; }
+void _d(U32 v)  { memcpy(_pc, &v, 4); _pc += 4; }
+void _q(U64 v)  { memcpy(_pc, &v, 8); _pc += 8; }
+void _rex(int w, int r, int b) {     ///> REX prefix, when needed
+    U8 x = 0x40 | (w << 3) | ((r >> 3) << 2) | (b >> 3);
+    if (x != 0x40) _b(x);
+}
+void _mrr(int r, int b) { _b(0xc0 | ((r & 7) << 3) | (b & 7)); }
+void _mrm(int r, int b, int d) {     ///> [b+d8]
+    int mod = (d || (b & 7) == rBP) ? 1 : 0;
+    _b((mod << 6) | ((r & 7) << 3) | (b & 7));
+    if ((b & 7) == rSP) _b(0x24);
+    if (mod) _b((U8)d);
+}
+void _cell() {                       ///> movsx opcode for a cell
+#if CELLSZ==2
+    _b(0x0f); _b(0xbf);
+#else  // CELLSZ==4
+    _b(0x63);
+#endif // CELLSZ==2
+}
+void _ld(int r, int b, int d)  { _rex(1, r, b); _cell(); _mrm(r, b, d); }   ///> r = (DU)[b+d]
+void _st(int r, int b, int d) {                                             ///> (DU)[b+d] = r
+#if CELLSZ==2
+    _b(0x66);
+#endif // CELLSZ==2
+    _rex(0, r, b); _b(0x89); _mrm(r, b, d);
+}
+void _canon(int r)             { _rex(1, r, r); _cell(); _mrr(r, r); }     ///> sign-extend cell
+void _ldq(int r, int b, int d) { _rex(1, r, b); _b(0x8b); _mrm(r, b, d); }  ///> r = [b+d]
+void _stq(int r, int b, int d) { _rex(1, r, b); _b(0x89); _mrm(r, b, d); }  ///> [b+d] = r
+void _lea(int r, int b, int d) { _rex(1, r, b); _b(0x8d); _mrm(r, b, d); }  ///> r = b+d
+void _alu(U8 op, int d, int s) { _rex(1, s, d); _b(op); _mrr(s, d); }       ///> op d, s
+void _mov(int d, int s)        { _alu(0x89, d, s); }
+void _test(int r)              { _alu(0x85, r, r); }
+void _grp(int n, int r)        { _rex(1, 0, r); _b(0xf7); _mrr(n, r); }     ///> not/neg r
+void _ip(int d, int s) {                                                    ///> d32 = (IU)s
+#if CELLSZ==2
+    _rex(0, d, s); _b(0x0f); _b(0xb7); _mrr(d, s);
+#else  // CELLSZ==4
+    _rex(0, s, d); _b(0x89); _mrr(s, d);
+#endif // CELLSZ==2
+}
+void _imm(int r, S64 v) {            ///> r = v
+    _rex(1, 0, r);
+    if (v == (S32)v) { _b(0xc7); _mrr(0, r); _d((U32)v); }
+    else             { _b(0xb8 | (r & 7)); _q((U64)v); }
+}
+void _addi(int r, int v) { _rex(1, 0, r); _b(0x83); _mrr(v < 0 ? 5 : 0, r); _b((U8)(v < 0 ? -v : v)); }
+void _call(void *f)      { _imm(rAX, (S64)f); _b(0xff); _b(0xd0); }         ///> call rax
+U8  *_jcc(U8 cc)         { _b(0x0f); _b(0x80 | cc); _d(0); return _pc; }    ///> returns fixup
+U8  *_jmp()              { _b(0xe9); _d(0); return _pc; }
+void _patch(U8 *j, U8 *to) { S32 r = (S32)(to - j); memcpy(j - 4, &r, 4); }
+///
+///> VM stack templates
+///
+void _push(int r)  { _addi(rBX, CELLSZ); _st(R12, rBX, 0); _mov(R12, r); }  ///> PUSH(r)
+void _pushi(DU v)  { _addi(rBX, CELLSZ); _st(R12, rBX, 0); _imm(R12, v); }  ///> PUSH(v)
+void _nos(int r)   { _ld(r, rBX, 0); _addi(rBX, -CELLSZ); }                 ///> r = *S--
+void _pop()        { _nos(R12); }                                           ///> POP()
+void _rpush(int r) { _st(R14, R13, -CELLSZ); _addi(R13, -CELLSZ); _mov(R14, r); }
+void _rpop()       { _ld(R14, R13, 0); _addi(R13, CELLSZ); }
+void _bool(U8 cc) {                  ///> T = cc ? TRUE : FALSE, ecx cleared before compare
+    _b(0x0f); _b(0x90 | cc); _b(0xc1);                 /// * setcc cl
+    _grp(3, rCX);                                      /// * neg rcx
+    _mov(R12, rCX);
+}
+void _cmp2(U8 cc) {                  ///> T = BOOL(*S-- cc T)
+    _nos(rAX);
+    _b(0x31); _b(0xc9);                                /// * xor ecx, ecx
+    _alu(0x39, rAX, R12);                              /// * cmp rax, r12
+    _bool(cc);
+}
+void _cmp0(U8 cc) {                  ///> T = BOOL(T cc 0)
+    _b(0x31); _b(0xc9);
+    _test(R12);
+    _bool(cc);
+}
+///
+///> compiler state for one word
+///
+typedef struct { U8 *j; int k; } Fix;   ///< forward branch to _ins[k]
+typedef struct { U8 *j; IU ip; } Bail;  ///< leave for the interpreter at ip
+Fix   _fix[JIT_OPS];
+Bail  _bail[JIT_OPS * 6];
+U8    *_ret[JIT_OPS];                   ///< jumps to the return sequence
+int   _nfix, _nbail, _nret;
+
+void _out(U8 *j, IU ip) { _bail[_nbail].j = j; _bail[_nbail++].ip = ip; }
+void _leave(U8 *j)      { _ret[_nret++] = j; }
+int  _find(int n, IU a) {            ///> op index at VM address a (-1: none)
+    int lo = 0, hi = n - 1;
+    while (lo <= hi) {
+        int m = (lo + hi) / 2;
+        if (_ins[m].ip == a) return m;
+        if (_ins[m].ip < a) lo = m + 1; else hi = m - 1;
+    }
+    return -1;
+}
+void _goto(int i, int k) {           ///> branch from _ins[i] to _ins[k]
+    if (k > i) {                     /// * forward
+        _fix[_nfix].j = _jmp(); _fix[_nfix++].k = k;
+        return;
+    }
+    U8 *to = _ins[k].pc;             /// * backward, poll now and then
+    _b(0x41); _b(0xff); _b(0xcf);                      /// * dec r15d
+    _patch(_jcc(cNE), to);
+    _imm(R15, JIT_POLL);
+    _call((void*)_poll);
+    _b(0x85); _b(0xc0);                                /// * test eax, eax
+    _patch(_jcc(cE), to);
+    _out(_jmp(), _ins[k].ip);
+}
+///
+///> decode word at xt, returns number of ops (0: not compilable)
+///
+int _scan(IU xt) {
+    IU ip = xt, hi = xt;
+    for (int n = 0; n < JIT_OPS; ) {
+        Ins &x = _ins[n++];
+        U8 op  = _bget(ip);
+        x.ip   = ip++;
+        x.arg  = 0;
+        x.op   = op;
+        if (op & 0x80) {             /// * colon call, token high-byte first
+            IU a = op & 0x7f;
+            for (int i=1; i < CELLSZ; i++) a = (a << 8) | _bget(ip++);
+            if (a >= FORTH_MEM_SZ) return 0;           /// * not a word, interpret
+            x.op  = opENTER;
+            x.arg = a;
+            continue;
+        }
+        switch (op) {
+        case opENTER: x.op = opNOP; break;             /// * bare opENTER does nothing
+        case opBYTE:  x.arg = _bget(ip++);  break;
+        case opDOLIT: x.arg = _get(ip); ip += CELLSZ; break;
+        case opBRAN: case opQBRAN: case opDONEXT:
+            x.arg = _get(ip); ip += CELLSZ;
+            if (x.arg < xt) {                          /// * jumps out of the word
+                if (op != opBRAN) return 0;
+            }
+            else if (x.arg > hi) hi = x.arg;
+            break;
+        case opEXIT:
+            if (x.ip >= hi) return n;                  /// * last EXIT, no branch beyond
+            break;
+        case opNOP:  case opSTORE: case opPSTOR: case opAT:   case opCSTOR:
+        case opCAT:  case opRFROM: case opRAT:   case opTOR:  case opDROP:
+        case opDUP:  case opSWAP:  case opOVER:  case opROT:  case opAND:
+        case opOR:   case opXOR:   case opINV:   case opLSH:  case opRSH:
+        case opADD:  case opSUB:   case opMUL:   case opNEG:  case opGT:
+        case opEQ:   case opLT:    case opZGT:   case opZEQ:  case opZLT:
+        case opONEP: case opONEM:  case opQDUP:  case opBL:   case opCELL:
+        case opMAX:  case opMIN:   case opULESS: break;
+        default: return 0;                             /// * no template, interpret
+        }
+    }
+    return 0;
+}
+///
+///> emit template of _ins[i]
+///
+void _emit(int n, int i) {
+    Ins &x = _ins[i];
+    IU  nx = (i + 1 < n) ? _ins[i + 1].ip : x.ip + 1;  ///< ip of next op
+    switch (x.op) {
+    case opNOP:   break;
+    case opEXIT:
+        _rex(1, 0, R14); _b(0xf7); _mrr(0, R14); _d((U32)IRET_FLAG);
+        _out(_jcc(cNE), x.ip);                         /// * ISR or task frame, interpreter
+        _ip(rAX, R14);                                 /// * ip = I
+        _rpop();
+        _leave(_jmp());
+        break;
+    case opENTER: {
+        IU rt = x.ip + CELLSZ;                         ///< return address
+#if STACK_GUARD
+        _lea(rCX, rBX, CELLSZ);                        /// * S+1
+        _lea(rDX, R13, -CELLSZ);                       /// * R after push
+        _alu(0x39, rCX, rDX);
+        _out(_jcc(cAE), x.ip);
+        _imm(rAX, (S64)&SPZ); _ldq(rAX, rAX, 0);
+        _test(rAX);
+        U8 *j = _jcc(cE);
+        _alu(0x39, rCX, rAX);
+        _out(_jcc(cAE), x.ip);
+        _alu(0x39, rDX, rAX);
+        _out(_jcc(cB), x.ip);
+        _patch(j, _pc);
+        _imm(rAX, (S64)&SP0); _ldq(rAX, rAX, 0);
+        _lea(rAX, rAX, -CELLSZ);
+        _alu(0x39, rBX, rAX);
+        _out(_jcc(cB), x.ip);                          /// * underflow
+#endif // STACK_GUARD
+        _imm(rAX, (S64)&_jfn[x.arg]);
+        _ldq(rAX, rAX, 0);
+        _test(rAX);
+        U8 *k = _jcc(cNE);
+        _imm(rDI, x.arg);
+        _call((void*)_lazy);                           /// * first call, compile callee
+        _patch(k, _pc);
+        _rex(1, 0, rAX); _b(0x83); _mrr(7, rAX); _b(1);   /// * cmp rax, NONE
+        _out(_jcc(cBE), x.ip);                         /// * callee not native
+        _st(R14, R13, -CELLSZ); _addi(R13, -CELLSZ);
+        _imm(R14, (DU)rt);                             /// * RPUSH(rt)
+        _b(0xff); _b(0xd0);                            /// * call rax
+        _b(0x3d); _d(rt);                              /// * cmp eax, rt
+        _leave(_jcc(cNE));                             /// * returned elsewhere, pass it on
+    } break;
+    case opBYTE:
+    case opDOLIT: _pushi((DU)x.arg); break;
+    case opBRAN: {
+        int k = _find(n, x.arg);
+        if (k < 0) _out(_jmp(), x.arg);                /// * tail call, interpreter goes on there
+        else       _goto(i, k);
+    } break;
+    case opQBRAN: {
+        int k = _find(n, x.arg);
+        _mov(rAX, R12); _pop(); _test(rAX);
+        U8 *j = _jcc(cNE);
+        _goto(i, k);
+        _patch(j, _pc);
+    } break;
+    case opDONEXT: {
+        int k = _find(n, x.arg);
+        _test(R14);
+        _lea(R14, R14, -1);                            /// * I-- (flags kept)
+        U8 *j = _jcc(cLE);
+        _goto(i, k);
+        _patch(j, _pc);
+        _rpop();
+    } break;
+    case opSTORE: case opCSTOR: case opPSTOR:
+        _ip(rDI, R12); _nos(rSI); _pop();
+        _imm(rDX, x.op == opSTORE ? 0 : x.op == opCSTOR ? 1 : 2);
+        _call((void*)_store);
+        _b(0x84); _b(0xc0);                            /// * test al, al
+        _out(_jcc(cNE), nx);                           /// * code dropped, interpreter
+        break;
+    case opAT: case opCAT:
+        _ip(rAX, R12);
+        _b(0x25); _d(FORTH_MEM_SZ - 1);                /// * and eax, mask
+        if (x.op == opCAT) {                           /// * movzx r12d, byte [rbp+rax]
+            _b(0x44); _b(0x0f); _b(0xb6); _b(0x64); _b(0x05); _b(0x00);
+            break;
+        }
+#if MEM_NATIVE
+        _rex(1, R12, rBP); _cell(); _b(0x64); _b(0x05); _b(0x00);
+#else  // !MEM_NATIVE, big-endian 16-bit
+        _b(0x0f); _b(0xb7); _b(0x4c); _b(0x05); _b(0x00); /// * movzx ecx, word [rbp+rax]
+        _b(0x66); _b(0xc1); _b(0xc1); _b(0x08);          /// * rol cx, 8
+        _rex(1, R12, rCX); _cell(); _mrr(R12, rCX);
+#endif // MEM_NATIVE
+        break;
+    case opRFROM: _push(R14); _rpop(); break;
+    case opRAT:   _push(R14); break;
+    case opTOR:   _rpush(R12); _pop(); break;
+    case opDROP:  _pop(); break;
+    case opDUP:   _addi(rBX, CELLSZ); _st(R12, rBX, 0); break;
+    case opSWAP:  _ld(rAX, rBX, 0); _st(R12, rBX, 0); _mov(R12, rAX); break;
+    case opOVER:  _ld(rAX, rBX, 0); _push(rAX); break;
+    case opROT:
+        _ld(rAX, rBX, -CELLSZ); _ld(rCX, rBX, 0);
+        _st(rCX, rBX, -CELLSZ); _st(R12, rBX, 0);
+        _mov(R12, rAX);
+        break;
+    case opAND:   _nos(rAX); _alu(0x21, R12, rAX); break;
+    case opOR:    _nos(rAX); _alu(0x09, R12, rAX); break;
+    case opXOR:   _nos(rAX); _alu(0x31, R12, rAX); break;
+    case opINV:   _grp(2, R12); break;
+    case opNEG:   _grp(3, R12); _canon(R12); break;
+    case opADD:   _nos(rAX); _alu(0x01, R12, rAX); _canon(R12); break;
+    case opSUB:   _nos(rAX); _alu(0x29, rAX, R12); _mov(R12, rAX); _canon(R12); break;
+    case opMUL:
+        _nos(rAX);
+        _rex(1, R12, rAX); _b(0x0f); _b(0xaf); _mrr(R12, rAX);   /// * imul r12, rax
+        _canon(R12);
+        break;
+    case opLSH: case opRSH:                            /// * int shift, as C does
+        _nos(rAX);
+        _b(0x44); _b(0x89); _b(0xe1);                  /// * mov ecx, r12d
+        _b(0xd3); _b(x.op == opLSH ? 0xe0 : 0xf8);     /// * shl/sar eax, cl
+        _mov(R12, rAX); _canon(R12);
+        break;
+    case opGT:    _cmp2(cG);  break;
+    case opEQ:    _cmp2(cE);  break;
+    case opLT:    _cmp2(cL);  break;
+    case opULESS: _cmp2(cB);  break;
+    case opZGT:   _cmp0(cG);  break;
+    case opZEQ:   _cmp0(cE);  break;
+    case opZLT:   _cmp0(cL);  break;
+    case opONEP:  _addi(R12, 1);  _canon(R12); break;
+    case opONEM:  _addi(R12, -1); _canon(R12); break;
+    case opQDUP: {
+        _test(R12);
+        U8 *j = _jcc(cE);
+        _addi(rBX, CELLSZ); _st(R12, rBX, 0);
+        _patch(j, _pc);
+    } break;
+    case opBL:    _pushi(0x20);   break;
+    case opCELL:  _pushi(CELLSZ); break;
+    case opMAX: case opMIN:
+        _nos(rAX);
+        _alu(0x39, rAX, R12);
+        _rex(1, R12, rAX); _b(0x0f); _b(x.op == opMAX ? 0x4f : 0x4c); _mrr(R12, rAX);  /// * cmovg/cmovl
+        break;
+    }
+}
+///
+///> entry thunk, rdi: native word
+///
+void _thunk() {
+    _run = (IU (*)(void*))_pc;
+    _b(0x55); _b(0x53);                                /// * push rbp, rbx
+    _b(0x41); _b(0x54); _b(0x41); _b(0x55);            /// * push r12, r13
+    _b(0x41); _b(0x56); _b(0x41); _b(0x57);            /// * push r14, r15
+    _addi(rSP, -8);                                    /// * align stack
+    _imm(rAX, (S64)&S);    _ldq(rBX, rAX, 0);
+    _imm(rAX, (S64)&T);    _ld(R12, rAX, 0);
+    _imm(rAX, (S64)&R);    _ldq(R13, rAX, 0);
+    _imm(rAX, (S64)&I);    _ld(R14, rAX, 0);
+    _imm(rAX, (S64)&_rom); _ldq(rBP, rAX, 0);
+    _imm(R15, JIT_POLL);
+    _b(0xff); _b(0xd7);                                /// * call rdi
+    _imm(rCX, (S64)&S);    _stq(rBX, rCX, 0);
+    _imm(rCX, (S64)&T);    _st(R12, rCX, 0);
+    _imm(rCX, (S64)&R);    _stq(R13, rCX, 0);
+    _imm(rCX, (S64)&I);    _st(R14, rCX, 0);
+    _addi(rSP, 8);
+    _b(0x41); _b(0x5f); _b(0x41); _b(0x5e);            /// * pop r15, r14
+    _b(0x41); _b(0x5d); _b(0x41); _b(0x5c);            /// * pop r13, r12
+    _b(0x5b); _b(0x5d);                                /// * pop rbx, rbp
+    _b(0xc3);
+    _code0 = _pc;
+}
+///
+///> compile word at xt, returns native code (NONE: interpret)
+///
+void *_compile(IU xt, U8 nested) {
+    int n = _scan(xt);
+    if (!n) return NONE;
+    for (int i = 0; i < n; i++) {    /// * branch targets on op boundaries
+        U8 op = _ins[i].op;
+        if ((op == opBRAN || op == opQBRAN || op == opDONEXT) &&
+            _find(n, _ins[i].arg) < 0) return NONE;
+    }
+    if (_jn >= JIT_WORDS || _pc + n * 256 + 64 > _code + JIT_CODE_SZ) {
+        if (nested) return NONE;     /// * native frames live, cannot flush
+        jit_flush();                 /// * full, start over
+    }
+    U8 *f = _pc;
+    _nfix = _nbail = _nret = 0;
+    _addi(rSP, -8);                  /// * align stack for helper calls
+    for (int i = 0; i < n; i++) {
+        _ins[i].pc = _pc;
+        _emit(n, i);
+    }
+    U8 *ret = _pc;                   /// * return sequence, eax = ip
+    _addi(rSP, 8);
+    _b(0xc3);
+    for (int i = 0; i < _nfix; i++) _patch(_fix[i].j, _ins[_fix[i].k].pc);
+    for (int i = 0; i < _nret; i++) _patch(_ret[i], ret);
+    for (int i = 0; i < _nbail; i++) {   /// * exits to the interpreter
+        _patch(_bail[i].j, _pc);
+        _b(0xb8); _d(_bail[i].ip);       /// * mov eax, ip
+        _patch(_jmp(), ret);
+    }
+    IU e = _ins[n - 1].ip;           /// * the last EXIT
+    _jw[_jn].xt    = xt;
+    _jw[_jn++].end = e;
+    memset(&_jcov[xt], 1, e - xt + 1);
+    return f;
+}
+void *_lazy(IU xt) {
+    if (!_jfn[xt]) _jfn[xt] = _compile(xt, 1);
+    return _jfn[xt];
+}
+///
+///> JIT interface
+///
+IU jit_exec(IU xt) {
+    if (!_code) {                    /// * first use
+        _code = (U8*)mmap(0, JIT_CODE_SZ, PROT_READ|PROT_WRITE|PROT_EXEC,
+                          MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+        if (_code == (U8*)MAP_FAILED) { _code = 0; return xt; }
+        _pc = _code;
+        _thunk();
+    }
+    if (xt >= FORTH_MEM_SZ) return xt;   /// * not in VM memory, interpret
+    void *f = _jfn[xt];
+    if (!f) f = _jfn[xt] = _compile(xt, 0);
+    return f == NONE ? xt : _run(f);
+}
+void jit_inv(IU a, IU n) {
+    for (IU i = 0; i < n; i++) {
+        IU x = (a + i) & (FORTH_MEM_SZ-1);
+        if (_jfn[x] == NONE) _jfn[x] = 0;  /// * retry, a new word may start here
+        if (!_jcov[x]) continue;
+        for (int k = 0; k < _jn; k++) {    /// * drop words over x
+            if (x < _jw[k].xt || x > _jw[k].end) continue;
+            _jfn[_jw[k].xt] = 0;
+            memset(&_jcov[_jw[k].xt], 0, _jw[k].end - _jw[k].xt + 1);
+            _jw[k--] = _jw[--_jn];
+        }
+        _dirty = 1;
+    }
+}
+void jit_flush() {
+    memset(_jfn,  0, sizeof(_jfn));
+    memset(_jcov, 0, sizeof(_jcov));
+    _jn = 0;
+    _pc = _code0;
+}
+} // namespace EfVM
+#endif // JIT_X64
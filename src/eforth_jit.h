@@ -0,0 +1,15 @@
+/**
+ * @file
+ * @brief eForth x86-64 template JIT interface (host only)
+ */
+#ifndef __EFORTH_JIT_H
+#define __EFORTH_JIT_H
+#include "eforth_core.h"
+
+namespace EfVM {
+IU   jit_exec(IU xt);      ///< run colon word xt natively, returns ip to resume at (xt: interpret it)
+void jit_inv(IU a, IU n);  ///< [a, a+n) written, drop native code over it
+void jit_flush();          ///< drop all native code
+} // namespace EfVM
+
+#endif // __EFORTH_JIT_H
@@ -98,6 +98,42 @@
         OP(TMISR), \
         OP(PCISR), \
         OP(TMRE),  \
-        OP(PCIE)
+        OP(PCIE),  \
+        OP(SCHED), \
+        OP(UNSCHED),\
+        OP(ILAT),  \
+        OP(ILAT0), \
+        OP(HWM),   \
+        OP(TASK),  \
+        OP(QUANT), \
+        OP(CPU),   \
+        OP(BANK),  \
+        OP(FAT),   \
+        OP(FSTOR), \
+        OP(FCAT),  \
+        OP(FCSTO), \
+        OP(TOFAR), \
+        OP(FARFR), \
+        OP(HEAP),  \
+        OP(ALLOC), \
+        OP(FREE),  \
+        OP(RESIZ), \
+        OP(AMARK), \
+        OP(AREL),  \
+        OP(QSTK),  \
+        OP(PRUNE), \
+        OP(SNAP),  \
+        OP(RESTO), \
+        OP(INL),   \
+        OP(INLF),  \
+        OP(TAIL),  \
+        OP(DODO),  \
+        OP(DOLOOP),\
+        OP(DOPLOOP),\
+        OP(UNLOOP),\
+        OP(LEAVE), \
+        OP(J),     \
+        OP(LITC),  \
+        OP(OPC)
 /// @}
 #endif // __EFORTH_OPCODE_H
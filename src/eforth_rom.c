@@ -4,131 +4,201 @@
 /// @attention 8K max ROM before changing FORTH_ROM_SZ in eforth_config.h 
 ///
 #include <stdint.h>
+#include "eforth_config.h"
 #if ARDUINO
 #include <Arduino.h>
 #else
 #define PROGMEM
 #endif
+/// @note cells in big-endian byte order (MEM_NATIVE=0)
 
-const uint32_t forth_rom_sz PROGMEM = 0xeb0;
+#if FORTH_TURNKEY  /// names stripped
+const uint32_t forth_rom_sz PROGMEM = 0xb80;
+#else
+const uint32_t forth_rom_sz PROGMEM = 0x1679;
+#endif // FORTH_TURNKEY
 const uint32_t forth_rom[] PROGMEM = {
-0x0000940e,0x504f4e03,0x04000100,0x49584504,0x00010154,0x4e45050c,0x02524554,0x03150001, // 0000 __.._NOP._.__EXIT__.__ENTER__.__
-0x03455942,0x041f0001,0x59454b3f,0x27000104,0x494d4504,0x00010554,0x59420430,0x01064554, // 0020 BYE__.__?KEY__.'_EMIT__.0_BYTE__
-0x44053900,0x54494c4f,0x42000107,0x564f4405,0x01085241,0x51074c00,0x4e415242,0x010c4843, // 0040 .9_DOLIT__.B_DOVAR__.L_QBRANCH__
-0x42065600,0x434e4152,0x00010d48,0x4f440662,0x5458454e,0x6d00010b,0x45584507,0x45545543, // 0060 .V_BRANCH__.b_DONEXT__.m_EXECUTE
-0x78000109,0x010e2101,0x2b028400,0x00010f21,0x1040018a,0x02910001,0x01112143,0x43029700, // 0080 __.x_!__.__+!__.__@__.__C!__.__C
-0x00011240,0x3e52029e,0xa5000113,0x14405202,0x02ac0001,0x0115523e,0x4404b300,0x16504f52, // 00a0 @__.__R>__.__R@__.__>R__.__DROP_
-0x03ba0001,0x17505544,0x04c30001,0x50415753,0xcb000118,0x45564f04,0x00011952,0x4f5203d4, // 00c0 _.__DUP__.__SWAP__.__OVER__.__RO
-0x00011a54,0x495004dd,0x011b4b43,0x4103e500,0x011c444e,0x4f02ee00,0x00011d52,0x4f5803f6, // 00e0 T__.__PICK__.__AND__.__OR__.__XO
-0x00011e52,0x4e4906fd,0x54524556,0x0501011f,0x48534c06,0x20544649,0x06100101,0x49485352, // 0100 R__.__INVERT_____LSHIFT ____RSHI
-0x01215446,0x2b011b01,0x26010122,0x01232d01,0x2a012c01,0x32010124,0x01252f01,0x4d033801, // 0120 FT!____+"__&_-#__,_*$__2_/%__8_M
-0x0126444f,0x4e063e01,0x54414745,0x01012745,0x283e0146,0x01510101,0x0101293d,0x2a3c0157, // 0140 OD&__>_NEGATE'__F_>(__Q_=)__W_<*
-0x025d0101,0x012b3e30,0x30026301,0x01012c3d,0x3c30026a,0x7101012d,0x2e2b3102,0x02780101, // 0160 __]_0>+__c_0=,__j_0<-__q_1+.__x_
-0x012f2d31,0x3f047f01,0x30505544,0x05860101,0x54504544,0x01013148,0x5052028f,0x99010132, // 0180 1-/____?DUP0____DEPTH1____RP2___
-0x334c4202,0x04a00101,0x4c4c4543,0xa7010134,0x53424103,0xb0010135,0x58414d03,0xb8010136, // 01a0 _BL3____CELL4____ABS5____MAX6___
-0x4e494d03,0xc0010137,0x54495706,0x384e4948,0x06c80101,0x5050553e,0x01395245,0x4305d301, // 01c0 _MIN7____WITHIN8____>UPPER9____C
-0x544e554f,0xde01013a,0x3b3c5502,0x06e80101,0x4d2f4d55,0x013c444f,0x5503ef01,0x013d2a4d, // 01e0 OUNT:____U<;____UM/MOD<____UM*=_
-0x4d02fa01,0x02013e2a,0x4d550302,0x02013f2b,0x2f2a0509,0x40444f4d,0x04110201,0x444f4d2f, // 0200 ___M*>____UM+?____*/MOD@____/MOD
-0x1b020141,0x422f2a02,0x03240201,0x43443e53,0x032b0201,0x44533e44,0x04330201,0x53424144, // 0220 A____*/B__$_S>DC__+_D>SD__3_DABS
-0x3b020145,0x454e4407,0x45544147,0x44020146,0x472b4402,0x02500201,0x01482d44,0x55065702, // 0240 E__;_DNEGATEF__D_D+G__P_D-H__W_U
-0x4f4d2f44,0x02014944,0x3044035e,0x2c182c3d,0x6902011c,0x17213202,0x22020615,0x010e130e, // 0260 D/MODI__^_D0=,_,___i_2!____"____
-0x32027402,0x10151740,0x22020613,0x82020110,0x55443204,0x01191950,0x32059002,0x504f5244, // 0280 _t_2@______"_____2DUP______2DROP
-0x02011616,0x5332059a,0x1a504157,0x01131a15,0x3205a502,0x5245564f,0x061b0306,0x02011b03, // 02a0 ______2SWAP________2OVER________
-0x454305b2,0x342b4c4c,0xc1020122,0x4c454305,0x23342d4c,0x05cc0201,0x4c4c4543,0x01243453, // 02c0 __CELL+4"____CELL-4#____CELLS4$_
-0x3202d702,0x2202062b,0x02e20201,0x02062d32,0xeb020123,0x062a3202,0x02012001,0x2f3202f4, // 02e0 ___2+__"____2-__#____2*__ ____2/
-0x01210106,0x5302fd02,0x00240730,0x03060301,0x4a405053,0x010f0301,0x03011449,0x52540517, // 0300 __!____S0_$.____SP@J____I_____TR
-0x4b454341,0x041d0301,0x45564153,0x2703014c,0x414f4c04,0x03014d44,0x41430430,0x014e4c4c, // 0320 ACEK____SAVEL__'_LOADM__0_CALLN_
-0x27043903,0x07424954,0x03010020,0x41420442,0x20074553,0x4d030102,0x07504302,0x03010420, // 0340 _9_'TIB_ .__B_BASE_ ___M_CP_ ___
-0x4f430758,0x5845544e,0x06200754,0x04610301,0x5453414c,0x01082007,0x27056f03,0x45444f4d, // 0360 X_CONTEXT_ ___a_LAST_ ___o_'MODE
-0x010a2007,0x27067a03,0x524f4241,0x0c200754,0x03860301,0x07444c48,0x03010e20,0x50530493, // 0380 _ ___z_'ABORT_ _____HLD_ _____SP
-0x20074e41,0x9d030110,0x4e493e03,0x01122007,0x2304a803,0x07424954,0x03011420,0x6d7403b2, // 03a0 AN_ _____>IN_ _____#TIB_ _____tm
-0x16200770,0x03bd0301,0x0459454b,0x01cb030c,0x3e05c703,0x52414843,0x171c7f06,0x38337f06, // 03c0 p_ _____KEY________>CHAR______38
-0x16e6030c,0x03015f06,0x454804d2,0x5b834552,0xe9030110,0x44415003,0x01002507,0x5403f403, // 03e0 __________HERE_[_____PAD_%.____T
-0x47834249,0xfe030110,0x4f4d4305,0x0d154556,0x12191a04,0x2e151119,0x040b2e13,0x01161612, // 0400 IB_G_____CMOVE_________._.______
-0x4d040804,0x3445564f,0x040d1525,0x19101937,0x2234150e,0x0b223413,0x16162d04,0x04220401, // 0420 ___MOVE4%___7_____4"_4"__-____"_
-0x4c4c4946,0x0d181518,0x95824e04,0x040b2e11,0x0116164a,0x44053f04,0x54494749,0x2a190906, // 0440 FILL_____N___.__J____?_DIGIT___*
-0x221c0706,0x01223006,0x48045604,0x83444c4f,0x172f1097,0x110e9783,0x026a0401,0xf883233c, // 0460 ___"_0"__V_HOLD___/_______j_<#__
-0x010e9783,0x53047b04,0x2d4e4749,0x0693040c,0x016f842d,0x45078604,0x41525458,0x00065443, // 0480 _____{_SIGN-____-_o____EXTRACT_.
-0x16ab8249,0x04015c84,0x83230196,0x9e841052,0x04016f84,0x532302a9,0x9582ab84,0x0c1f6d82, // 04a0 I_________#_R____o____#S_____m__
-0x040dc504,0xb50401b8,0x823e2302,0x109783a0,0x2319f883,0x04c80401,0x52545344,0x16159582, // 04c0 _________#>________#____DSTR____
-0x847e8445,0x8b8413b8,0x0401cb84,0x545303d7,0xdc844352,0x03ed0401,0x06584548,0x0e528310, // 04e0 E_~___________STRC______HEX___R_
-0x07f70401,0x49434544,0x064c414d,0x0e52830a,0x06030501,0x49474944,0x39153f54,0x06233006, // 0500 ____DECIMAL___R_____DIGIT?_9_0#_
-0x0c2a1909,0x07062e05,0x0a061723,0x13171d2a,0x1305013b,0x4d554e07,0x3f524542,0x15105283, // 0520 __*__.__#___*___;____NUMBER?_R__
-0x3a190006,0x24061219,0x52050c29,0x2e18fb84,0x12192f18,0x15292d06,0x18231418,0x0c302214, // 0540 _._:___$)__R___._/___-)___#__"0_
-0x152f8d05,0x83121517,0x1a851052,0x1884050c,0x24105283,0x0b2e1322,0x14166405,0x2780050c, // 0560 __/_____R________R_$"_.__d_____'
-0x8c050d18,0xa0821313,0x0006a082,0xa0821317,0x0e528313,0x05340501,0x43415053,0x01053345, // 0580 ___________.______R___4_SPACE3__
-0x43059705,0x53524148,0x36000618,0xb2050d15,0x050b0517,0x050116b0,0x505306a2,0x53454341, // 05a0 ___CHARS__.6______________SPACES
-0x01a88533,0x5404b905,0x15455059,0x3ad3050d,0x0b05d883,0x0116cf05,0x4302c605,0x050d0652, // 05c0 3______TYPE____:___________CR___
-0x01050a06,0x6403da05,0x1413246f,0x15223a13,0x013a1518,0x2403e605,0xea857c22,0x03f60501, // 05e0 _______do$___:"___:____$"|______
-0x857c222e,0x01cb85ea,0x2e02ff05,0xf1841552,0x85231913,0x01cb85c0,0x55030a06,0x4315522e, // 0600 ."|________.R_____#________U.R_C
-0xb8847e84,0x1913cb84,0x85c08523,0x1a0601cb,0x062e5502,0x011e8601,0x2e013006,0x9d85f184, // 0620 _~______#________U.______0_.____
-0x0601cb85,0x103f013a,0x06013c86,0x70280745,0x65737261,0x11c18329,0x0c171519,0x832fa506, // 0640 ____:_?__<__E_(parse)_________/_
-0x293312c1,0x157c060c,0x23121933,0x060c1f2d,0x060b2e7b,0x06161368,0x13011700,0x83151819, // 0660 __3)__|_3__#-___{.__h___._______
-0x121912c1,0x12c18323,0x060c2933,0x060c2d8e,0x060b2e9a,0x0d15177f,0x16139f06,0x19152e17, // 0680 ____#___3)___-___.___________.__
-0x23131323,0x23131901,0x054d0601,0x4b434150,0x82151724,0x182e1195,0x01130e84,0x5005ab06, // 06a0 #__#___#__M_PACK$_____.________P
-0x45535241,0x83028415,0x832210ac,0xac8310b7,0x86132310,0x0fac8355,0x05be0601,0x454b4f54, // 06c0 ARSE______"______#__U_______TOKE
-0xc486334e,0x83371f06,0x862234ee,0xdb0601b1,0x524f5704,0x83c48644,0x862234ee,0xf00601b1, // 06e0 N3____7__4"______WORD____4"_____
-0x4d414e05,0x063a3e45,0x01221c1f,0x53050007,0x3f454d41,0x0d958215,0x12173407,0x182e1539, // 0700 _NAME>:___"__._SAME?_____4__9_._
-0x15391217,0x1313182e,0x070c3023,0x15161334,0x0113a082,0x821a070b,0x010006a0,0x46040e07, // 0720 __9_.___#0__4_____________.____F
-0x18444e49,0xc1831217,0x1510170e,0x10182234,0x7e070c17,0x3f071017,0x5f071cff,0x07141c5f, // 0740 IND_________4"_____~___?________
-0x1e1c5f5f,0x346f070c,0xffff0722,0x347b070d,0x10c18322,0x070c172f,0x0d14877b,0x16138507, // 0760 ______o4"_____{4"___/___{_______
-0x18233418,0x8f070c01,0x23342334,0x134f070d,0x34161816,0x06871723,0x3e070118,0x4d414e05, // 0780 _4#_____4#4#__O____4#______>_NAM
-0x69833f45,0x07014387,0x485e029c,0x18131915,0x070c1e19,0x050806be,0x0605332f,0x07010508, // 07a0 E?_i_C____^H____________/3______
-0x415403a9,0x19051750,0x07012e11,0x546b04c1,0x06175041,0x070c1e0a,0x1e0806e8,0x33e5070c, // 07c0 __TAP____.____kTAP_____________3
-0x070dc587,0x01ac87e7,0x17161816,0x06cd0701,0x45434341,0x22195450,0x1e958219,0x8314080c, // 07e0 ________________ACCEPT_"________
-0x233317cb,0x0c3b5f06,0xc5870f08,0x8711080d,0xf9070dd2,0x01231916,0x4506ef07,0x43455058, // 0800 __3#__;_______________#____EXPEC
-0x83f68754,0x01160ea2,0x51051a08,0x59524555,0x80060284,0xb783f687,0x0006160e,0x010eac83, // 0820 T__________QUERY___________.____
-0x41052a08,0x54524f42,0x30108d83,0x0950080c,0x05420801,0x4f525245,0x3a9d8552,0x3f06cb85, // 0840 _*_ABORT___0__P___B_ERROR__:___?
-0x88dd8505,0x0a530848,0x544e4924,0x52505245,0xa2875445,0x94080c30,0x1c400612,0x1692080c, // 0860 ____H_S_$INTERPRET__0_____@_____
-0x630c0386,0x69706d6f,0x6f20656c,0x0d796c6e,0x01099308,0x080c3c85,0x080d019d,0x0859889f, // 0880 ___compile only______<________Y_
-0x075b8167,0x80837208,0xa108010e,0x4b4f2e03,0x0807dd85,0x10808372,0xd0080c29,0x37040631, // 08a0 g_[__r_______.OK____r___)___1__7
-0x861b1415,0xc1080b3c,0x20050386,0x203e6b6f,0x04ac0801,0x4c415645,0x1217e186,0x83ea080c, // 08c0 ____<______ ok> ____EVAL________
-0x0c301080,0x0d09e708,0x8816d808,0xd30801b0,0x49555104,0x80240754,0x880e4783,0x883088a3, // 08e0 __0______________QUIT_$__G____0_
-0xfd080dd8,0x2c01f008,0x3417ee83,0x0e5b8322,0x0609010e,0x832c4302,0x832e17ee,0x01110e5b, // 0900 _______,___4"_[______C,___._[___
-0x41051409,0x544f4c4c,0x010f5b83,0x4c872209,0x52455449,0x07174c41,0x0c1c00ff,0x07064709, // 0920 ___ALLOT_[___"_LITERAL___.___G__
-0x08891789,0x064d090d,0x89178906,0x2e090117,0x4d4f4307,0x454c4950,0x89121713,0x01152e17, // 0940 ______M________._COMPILE_____.__
-0x24085009,0x504d4f43,0x87454c49,0x090c30a2,0x80061299,0x7c090c1c,0x98090d09,0x20071717, // 0960 _P_$COMPILE__0_________|_______ 
-0x2e182a00,0x29010612,0x92090c1c,0x0d178912,0x80079809,0x08891d00,0x0c3c8501,0x3689a109, // 0980 .*_.___)____________._____<____6
-0x09598801,0x553f0762,0x5551494e,0xa2871745,0xc5090c30,0x1c1f063a,0xcb859d85,0x20060386, // 09a0 __Y_b_?UNIQUE___0___:__________ 
-0x65446572,0x09011666,0x2c2403a5,0x0c10176e,0xad89e609,0x83068717,0x83170e5b,0x23340e74, // 09c0 reDef_____$,n___________[___t_4#
-0x18106983,0x5988010e,0x2701c909,0xa287e186,0x01f4090c,0xea095988,0x09075d01,0x0e80836b, // 09e0 _i_____Y___'_________Y___]__k___
-0x89f80901,0x4d4f435b,0x454c4950,0x89ec895d,0x030a0108,0xe1863a01,0xfa89cd89,0x81140a01, // 0a00 ____[COMPILE]________:__________
-0x0158893b,0x7483a388,0x0e698310,0x051f0a01,0x4d414e3e,0x12172f45,0x061c7f06,0x0a0c2a20, // 0a20 ;_X____t__i_____>NAME/______ *__
-0x2f0a0135,0x4d554404,0x10528350,0x06fb8415,0x1006221f,0x0a0d1525,0x06dd8593,0x19958210, // 0a40 5__/_DUMP_R______"__%___________
-0x1e860506,0x053a0615,0x85880a0d,0x4312179d,0x9e841006,0x84100615,0x0513059e,0x142ea082, // 0a60 ______:________C______________._
-0x0c290806,0x9d85880a,0x156b0a0b,0x9d859d85,0x0b13cb85,0x1316590a,0x010e5283,0x5705440a, // 0a80 __)_______k__________Y___R___D_W
-0x5344524f,0x6983dd85,0xc1830006,0x0c30100e,0x3a17d80a,0x171c1f06,0xc1832e2e,0x85cb850f, // 0aa0 ORDS___i_.____0____:____..______
-0x349d859d,0x10c18323,0x0c284006,0xdd85d50a,0xc1830006,0xad0a0d0e,0x069e0a01,0x47524f46, // 0ac0 ___4#____@(______.__________FORG
-0xe1865445,0x0c30a287,0x2334fa0a,0x0e5b8317,0x69831710,0x0e74830e,0x59880116,0x2e05db0a, // 0ae0 ET____0___4#__[____i__t____Y___.
-0x52444441,0x8617dd85,0x053a063c,0x03fe0a01,0x17504f2e,0x0c1c8006,0x17164b0b,0xff7f0710, // 0b00 ADDR____<_:_____.OP______K______
-0x9d85171c,0x853a358a,0x060717cb,0x07182903,0x1d29fa05,0x85480b0c,0x3a22349d,0xcb859582, // 0b20 _____5:______)____)___H__4":____
-0x22052206,0x4b0b0d01,0x17012234,0x0c290606,0x2e165a0b,0x3c861217,0x0617012e,0x0b0c2907, // 0b40 _"_"___K4"____)__Z_.___<.____)__
-0x172e166a,0x343c8610,0x06170122,0x0b0c2908,0x2e2e167d,0x3c861017,0x2f057606,0x0d061701, // 0b60 j_.___<4"____)__}_..___<_v_/____
-0x920b0c29,0x10172e16,0x6a063c86,0x8b223405,0x06170104,0x0b0c290c,0x172e16a7,0x063c8610, // 0b80 )____.___<_j_4"______)____.___<_
-0x2234053f,0x1701048b,0x0c290b06,0x2e16bc0b,0x3c861017,0x34056e06,0x01048b22,0x290a0617, // 0ba0 ?_4"______)____.___<_n_4"______)
-0x16dc0b0c,0x1812172e,0x86102e17,0x052a063c,0x17102e22,0x6a063c86,0x01048b05,0x69839d85, // 0bc0 ____.____.__<_*_".___<_j_______i
-0x0c0c1710,0x06871706,0x06122e17,0x0c0c2901,0x19151200,0x0b0c2913,0xcb853aff,0x17012e16, // 0be0 _________.___)__.____)___:___.__
-0x0d233416,0x3c86e00b,0x16053f06,0x0f0b012e,0x45455303,0x048bec89,0x06171217,0x0c1f2901, // 0c00 _4#____<_?__.____SEE_________)__
-0x138b270c,0x82180c0d,0x069d85a0,0x0c01053b,0x48418510,0x89444145,0xee830d58,0x08890006, // 0c20 _'__________;_____AHEAD_X____.__
-0x85310c01,0x49414741,0x0d58894e,0x0c010889,0x45428543,0x834e4947,0x510c01ee,0x544e5585, // 0c40 __1_AGAIN_X_____C_BEGIN____Q_UNT
-0x58894c49,0x5c0c010c,0x89464982,0xee830c58,0x08890006,0x84680c01,0x4e454854,0x0e18ee83, // 0c60 IL_X_____IF_X____.____h_THEN____
-0x84770c01,0x45534c45,0x8c18378c,0x830c017c,0x49485785,0x6b8c454c,0x900c0118,0x45485784, // 0c80 __w_ELSE_7__|____WHILE_k_____WHE
-0x196b8c4e,0x869c0c01,0x45504552,0x498c5441,0x0c017c8c,0x4f4683a7,0x15588952,0x0c01ee83, // 0ca0 N_k_____REPEAT_I_|____FOR_X_____
-0x464183b5,0x378c1654,0x0118ee83,0x4e84c10c,0x89545845,0x08890b58,0x03ce0c01,0x06222c24, // 0cc0 __AFT__7_______NEXT_X_______$,"_
-0x3af58622,0x0e5b8322,0x82db0c01,0x85072224,0x0eee83fa,0x0c01df8c,0x222e82eb,0x83038607, // 0ce0 "__:"_[_____$"____________."____
-0xdf8c0eee,0x04f90c01,0x45444f43,0xcd89e186,0x83107483,0x0d010e69,0x52430607,0x45544145, // 0d00 ________CODE_____t__i_____CREATE
-0x58890c8d,0x01588908,0x05190d01,0x53454f44,0xee83133e,0x87107483,0x23151706,0x140a062f, // 0d20 ___X__X_____DOES>____t_____#/___
-0x112e1311,0x890d5889,0x01588908,0x082b0d01,0x49524156,0x454c4241,0x0006208d,0x0d010889, // 0d40 __.__X____X___+_VARIABLE_ _.____
-0x4f43084f,0x4154534e,0x0c8d544e,0x17890706,0x0406ee83,0x89088922,0x58891058,0x01088901, // 0d60 O_CONSTANT__________"___X__X____
-0x3209610d,0x49524156,0x454c4241,0x0006208d,0x89088917,0x820d0108,0x4f433209,0x4154534e, // 0d80 _a_2VARIABLE_ _._________2CONSTA
-0x0c8d544e,0x17890706,0x0406ee83,0x82088922,0x01588985,0x89088918,0x980d0108,0x06282e82, // 0da0 NT__________"_____X__________.(_
-0x85c48629,0xbc0d01cb,0x0a065c81,0x0116f586,0x2881c80d,0xc4862906,0x0d01a082,0x4f430cd2, // 0dc0 )__________________(_)________CO
-0x4c49504d,0x4e4f2d45,0x7483594c,0x06121710,0x11181d40,0x09dd0d01,0x454d4d49,0x54414944, // 0de0 MPILE-ONLY_t____@_______IMMEDIAT
-0x10748345,0x80061217,0x0111181d,0x4305f70d,0x4b434f4c,0x0e0e014f,0x4e495007,0x45444f4d, // 0e00 E_t____________CLOCKO____PINMODE
-0x180e0150,0x50414d03,0x240e0151,0x524e4902,0x032c0e01,0x5354554f,0x03330e01,0x544e4941, // 0e20 P____MAPQ__$_INR__,_OUTS__3_AINT
-0x033b0e01,0x554d5750,0x05430e01,0x53494d54,0x0e015652,0x4350054b,0x57525349,0x05550e01, // 0e40 __;_PWMU__C_TMISRV__K_PCISRW__U_
-0x454d4954,0x0e015852,0x4350055f,0x59544e49,0x05690e01,0x414c4544,0x474f4359,0x7782c183, // 0e60 TIMERX____PCINTY__i_DELAYCOG___w
-0x8582c183,0x182d484f,0x800e0c16,0x04730e01,0x444c4f43,0x838f0e07,0x0e070e69,0x0e74838f, // 0e80 ____OH-_______s_COLD____i_____t_
-0x83720807,0x08070e80,0x0e8d83f5,0xf588dd85,0x00000000,0x00000000,0x00000000,0x00000000, // 0ea0 __r_____________................
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000, // 0ec0 ................................
+0x0100590b,0x01020101,0x01040103,0x01060105,0x01080107,0x010d010c,0x0176010b,0x01780177, // 0000 _Y._______________________v_w_x_
+0x010e0109,0x0110010f,0x01120111,0x01140113,0x01160115,0x01180117,0x011a0119,0x011c011b, // 0020 ________________________________
+0x011e011d,0x0120011f,0x01220121,0x01240123,0x01260125,0x01280127,0x012a0129,0x012c012b, // 0040 ______ _!_"_#_$_%_&_'_(_)_*_+_,_
+0x012e012d,0x0130012f,0x01320131,0x01340133,0x01360135,0x01380137,0x013a0139,0x013c013b, // 0060 -_._/_0_1_2_3_4_5_6_7_8_9_:_;_<_
+0x013e013d,0x0140013f,0x01420141,0x01440143,0x01460145,0x01480147,0x182c0149,0x17011c2c, // 0080 =_>_?_@_A_B_C_D_E_F_G_H_I_,_,___
+0x22020615,0x010e130e,0x13101517,0x10220206,0x01191901,0x1a011616,0x01131a15,0x061b0306, // 00a0 ___"__________"_________________
+0x34011b03,0x23340122,0x01243401,0x01220206,0x01230206,0x01200106,0x01210106,0x0114014a, // 00c0 ___4"_4#_4$___"___#___ ___!_J___
+0x0179017b,0x014b017a,0x014d014c,0x2007014e,0x20070100,0x20070102,0x20070104,0x20070106, // 00e0 {_y_z_K_L_M_N__ .__ ___ ___ ___ 
+0x20070108,0x2007010a,0x2007010c,0x2007010e,0x20070110,0x20070112,0x20070114,0x20070116, // 0100 ___ ___ ___ ___ ___ ___ ___ ___ 
+0x20070118,0x2007011a,0x2007011c,0x2007011e,0x20070120,0x20070122,0x20070124,0x20070126, // 0120 ___ ___ ___ ___  __ "__ $__ &__ 
+0x20070128,0x20070138,0x1e81013a,0x0c040110,0x06014e01,0x06171c7f,0x0c38337f,0x06166101, // 0140 (__ 8__ :________N_______38__a__
+0xf680015f,0x22810110,0x10268110,0xee800122,0x0d150110,0x12197e01,0x2e151119,0x010b2e13, // 0160 _______"__&_"________~_____._.__
+0x01161676,0x0d152534,0x10199401,0x34150e19,0x22341322,0x168a010b,0x15180116,0xa4010d18, // 0180 v___4%_________4"_4"____________
+0x2e11b180,0x16a0010b,0x09060116,0x07062a19,0x3006221c,0x0a810122,0x81172f10,0x01110e0a, // 01a0 ___._________*___"_0"____/______
+0x0a816681,0x0c2d010e,0x2d06ce01,0x0601b681,0xb7804900,0x01aa8116,0x8110f280,0x01b681cf, // 01c0 _f____-____-____.I______________
+0xb180d881,0x0c1f9a80,0x010ded01,0xb48001e0,0x81100a81,0x01231966,0x1615b180,0x81c08145, // 01e0 ____________________f_#_____E___
+0xc68113e0,0x4301ee81,0x0601f881,0x0ef28010,0x800a0601,0x15010ef2,0x23300639,0x2a190906, // 0200 _______C________________9_0#___*
+0x062b020c,0x06172307,0x171d2a0a,0x80013b13,0x061510f2,0x193a1900,0x29240612,0x8245020c, // 0220 __+__#___*___;______._:___$)__E_
+0x182e180b,0x0612192f,0x1815292d,0x14182314,0x020c3022,0x17152f80,0xf2801215,0x0c178210, // 0240 __._/___-)___#__"0___/__________
+0x80187702,0x222410f2,0x020b2e13,0x0c141657,0x18277302,0x137f020d,0x80b48013,0x170006b4, // 0260 _w____$"_.__W____s'___________._
+0x13b48013,0x010ef280,0x18010533,0x15360006,0x1795020d,0x93020b05,0x82330116,0x0d15018b, // 0280 ________3____.6___________3_____
+0x813aa602,0x020b0553,0x060116a2,0x0a06050d,0x14130105,0x15223a13,0x013a1518,0x8201b282, // 02a0 __:_S________________:"___:_____
+0x019e82b2,0x13078215,0x9a822319,0x15019e82,0x81c08143,0x13ee81e0,0x9a822319,0x06019e82, // 02c0 _________#______C________#______
+0x01cf8201,0x88820782,0x10019e82,0x8101e482,0x1519111a,0x3f030c17,0x121a812f,0x030c2933, // 02e0 _______________________?/___3)__
+0x19331516,0x1f2d2312,0x2e15030c,0x1302030b,0x17000616,0x18191301,0x121a8115,0x81231219, // 0300 __3__#-____.______.___________#_
+0x2933121a,0x2d28030c,0x2e34030c,0x1719030b,0x39030d15,0x2e171613,0x13231915,0x19012313, // 0320 __3)__(-__4._______9___.__#__#__
+0x17012313,0x11b18015,0x7281182e,0x81150113,0x1012816e,0x10168122,0x23101281,0x81ef8213, // 0340 _#______.__r____n___"______#____
+0x33010f12,0x1f064e83,0x34628137,0x01438322,0x62814e83,0x43832234,0x06121701,0x3a181c20, // 0360 ___3_N__7_b4"_C__N_b4"_C____ __:
+0x221c1f06,0x89030c18,0x80150110,0xaa030db1,0x15391217,0x1217182e,0x182e1539,0x30231313, // 0380 ___"______________9_.___9_.___#0
+0x13aa030c,0xb4801516,0x030b0113,0x06b48090,0x17180100,0x0e1a8112,0x34151017,0x17101822, // 03a0 ________________.__________4"___
+0x17ed030c,0xff1f0710,0x5f5f071c,0x5f07141c,0x0c1e1c5f,0x2234de03,0x0dffff07,0x2234ea03, // 03c0 ______________________4"______4"
+0x2f101a81,0xea030c17,0x030d8a83,0x181613f4,0x01182334,0x34fe030c,0x0d233423,0x1613be03, // 03e0 ___/____________4#_____4#4#_____
+0x23341618,0x18798317,0x063e8101,0x10171507,0x27040c30,0xb283181a,0x21040c30,0x1613161a, // 0400 __4#__y___>_____0__'____0__!____
+0x22341801,0x132d040d,0x00061616,0x0e040b01,0x01000616,0x18131915,0x040c1e19,0x05080646, // 0420 __4"__-____.______._________F___
+0x0605332f,0x17010508,0x2e111905,0x0a061701,0x63040c1e,0x0c1e0806,0x84336004,0x62040d47, // 0440 /3_________._______c_____`3_G__b
+0x16013484,0x01171618,0x80192219,0x040c1eb1,0x174e8186,0x5f062333,0x81040c3b,0x040d4784, // 0460 _4_______"________N_3#__;____G__
+0x0d4d8483,0x19166b04,0x68840123,0x160e0e81,0x816e8101,0x68841026,0x160e1681,0x12810006, // 0480 __M__k__#__h______n_&__h_____.__
+0x0681010e,0x040c3010,0x6f0109aa,0x3a888201,0x3f069e82,0x84ab8205,0x300984a2,0x12db040c, // 04a0 _____0_____o___:___?_______0____
+0x0c1c4006,0x8216d904,0x6f630cbf,0x6c69706d,0x6e6f2065,0x040d796c,0x820109da,0xe4040c2f, // 04c0 _@________compile only______/___
+0xe6040d01,0x0407ad84,0x0e0281b9,0x07ab8201,0x0281b904,0x050c2910,0x0406310d,0x1b141537, // 04e0 _____________________)___1__7___
+0x040be482,0x05bf82fe,0x3e6b6f20,0x63830120,0x050c1217,0x10028121,0x1d050c30,0x050d6f09, // 0500 ________ ok> __c____!___0____o__
+0xed84160e,0x10228101,0x840eee80,0x859184e6,0x2d050d0e,0x34176281,0x0ef68022,0x6281010e, // 0520 ______"____________-_b_4"______b
+0xf6802e17,0x8001110e,0x81010ff6,0x0e428162,0x21080617,0x851d8006,0x013e853e,0x1713017c, // 0540 _.__________b_B____!____>_>_|___
+0x2e3e8512,0x01730115,0x0c300984,0x0612a405,0x050c1c80,0x050d0979,0x071717a3,0x182a0020, // 0560 __>.__s___0_________y_______ .*_
+0x0106122e,0x12191c29,0x08060606,0x0c1c2c38,0x7d129705,0x17a3050d,0x050c2c73,0x0d4b85a2, // 0580 .___)_______8,_____}____s,____K_
+0x0116a305,0x050c2f82,0x015c85ac,0x8417ad84,0x050c3009,0x1f063ac6,0x8288821c,0x06bf829e, // 05a0 _____/___________0___:__________
+0x44657220,0x01166665,0x152e1217,0x14102a81,0x17233423,0x2a812334,0x1419180e,0x62817281, // 05c0  reDef____.__*__#4#_4#_*_____r_b
+0x0e221319,0x20061217,0x0111191d,0x050c1017,0x81ae85fb,0x050c102e,0x17c885fb,0xf6807983, // 05e0 __"____ ____________.________y__
+0xfe80170e,0x8123340e,0x18101036,0xad84010e,0x09846383,0x0118060c,0x0507ad84,0x0e028168, // 0600 _____4#_6________c__________h___
+0x81170006,0x46810e42,0x1086010e,0x83014b85,0x86ec8563,0x8575011a,0xe684015e,0x8110fe80, // 0620 _.__B__F_____K__c_____u_^_______
+0x010e1036,0x015e8575,0x81000601,0x80010e42,0x798310fe,0x10014b85,0x6a060c17,0x7983b180, // 0640 6___u_^___._B______y_K_____j___y
+0x65060c29,0x0d233401,0x80015706,0x305786fa,0x1876060c,0x3a810116,0x060c1710,0x86151790, // 0660 )__e_4#__W____W0__v____:________
+0x060c3057,0x1316188a,0x34130116,0x78060d22,0x30011618,0x3a9e060c,0x821c1f06,0x3f06019e, // 0680 W0_________4"__x___0___:_______?
+0xf2800105,0x0b821510,0x06221f06,0x0d152510,0xab82ec06,0xb1801006,0x82050619,0x3a0615cf, // 06a0 __________"__%_________________:
+0xe1060d05,0x12178882,0x81100643,0x100615cf,0x1305cf81,0x2eb48005,0x29080614,0x82e1060c, // 06c0 ________C______________.___)____
+0xc4060b88,0x82888215,0x139e8288,0x16b2060b,0x0ef28013,0x81ab8201,0x0006103e,0x100e1a81, // 06e0 ________________________>__.____
+0x2a070c30,0x1f063a17,0x2e2e171c,0x820f1a81,0x8288829e,0x81233488,0x4006101a,0x27070c28, // 0700 0__*_:____.._________4#____@(__'
+0x0006ab82,0x0d0e1a81,0x8301ff06,0x10368163,0x0c30b283,0x12176307,0x0c1c2006,0x80195007, // 0720 ___.________c_6___0__c___ ___P__
+0x3a170ef6,0x221c1f06,0x2a812234,0x56070d0e,0x80233417,0x23340ef6,0x36811710,0xfe800e10, // 0740 ___:___"4"_*___V_4#___4#___6____
+0x8401160e,0xffff07ad,0x010e2e81,0x2e810006,0x0170010e,0x01720171,0x8217ab82,0x053a06e4, // 0760 _________.___._.__p_q_r_______:_
+0x80061701,0xb8070c1c,0x07101716,0x171cff7f,0x6b868882,0x07179386,0x1829bf02,0x29bc0207, // 0780 ___________________k______)____)
+0xb5070c1d,0x22348882,0x82b1803a,0x0522069e,0x070d0122,0x012234b8,0x29060617,0x16c7070c, // 07a0 ______4":_____"_"____4"____)____
+0x8212172e,0x17012ee4,0x0c290706,0x2e16d707,0xe4821017,0x17012234,0x0c290806,0x2e16ea07, // 07c0 .____.____)____.____4"____)____.
+0x8210172e,0x057606e4,0x0617012f,0x070c290d,0x172e16ff,0x06e48210,0x2234056a,0x17017887, // 07e0 ._____v_/____)____._____j_4"_x__
+0x0c290c06,0x2e161408,0xe4821017,0x34053f06,0x01788722,0x290b0617,0x1629080c,0x8210172e, // 0800 __)____._____?_4"_x____)__)_.___
+0x056e06e4,0x78872234,0x76061701,0x0c387906,0x2e164008,0xe4821017,0x34056c06,0x01788722, // 0820 __n_4"_x___v_y8__@_._____l_4"_x_
+0x290a0617,0x1660080c,0x1812172e,0x82102e17,0x052a06e4,0x17102e22,0x6a06e482,0x01788705, // 0840 ___)__`_.____.____*_"._____j__x_
+0xfa808882,0x080c1710,0x79831789,0x06122e17,0x080c2901,0x19151283,0x080c2913,0x16938682, // 0860 ___________y_.___)_______)______
+0x1617012e,0x080d2334,0x06e48264,0x2e16053f,0x87108601,0x17121778,0x1f290106,0x87a4080c, // 0880 .___4#__d___?__.____x_____)_____
+0x95080d81,0x8882b480,0x01053b06,0x810d5e85,0x85000662,0x5e850134,0x0134850d,0x00066281, // 08a0 _________;___^__b_._4__^__4__b_.
+0x010e4681,0x850c5e85,0x5e850134,0x0662810c,0x01348500,0x0e186281,0x81170006,0x46810e42, // 08c0 _F___^__4__^__b_._4__b___.__B__F
+0xac88010e,0x01d48818,0x0118ca88,0x0119ca88,0xd488b688,0x155e8501,0x16016281,0x6281ac88, // 08e0 ______________________^__b_____b
+0x5e850118,0x0134850b,0x81765e85,0x85000662,0x01628134,0x85775e85,0x01d48834,0x85785e85, // 0900 ___^__4__^v_b_._4_b__^w_4____^x_
+0x01d48834,0x70832206,0xf680223a,0x8207010e,0x0e6281bc,0x07012489,0x6281bf82,0x0124890e, // 0920 4____"_p:"________b__$_____b__$_
+0xec856383,0x8110fe80,0x010e1036,0x5e854089,0x015e8508,0x62811301,0x8310fe80,0x23151779, // 0940 _c______6____@_^__^____b____y__#
+0x140a062f,0x112e1311,0x850d5e85,0x015e8534,0x064c8901,0x01348500,0x07064089,0x62813e85, // 0960 /_____.__^__4_^___L_._4__@___>_b
+0x85220406,0x105e8534,0x85015e85,0x4c890134,0x85170006,0x01348534,0x07064089,0x62813e85, // 0980 __"_4_^__^__4__L_.__4_4__@___>_b
+0x85220406,0x85a88034,0x8518015e,0x01348534,0x07100281,0x0c296805,0x8518bf09,0x06017d5c, // 09a0 __"_4___^___4_4______h)______}__
+0x090c290e,0x0f010ec7,0x18628101,0x40893485,0x3e850706,0x5e853485,0x015e8510,0x2e108601, // 09c0 _)________b__4_@___>_4_^__^____.
+0x890e0610,0x108601b0,0x0f06102e,0x8901b089,0x0d5e8540,0x22346281,0x5e853485,0x10860101, // 09e0 ________._______@_^__b4"_4_^____
+0x890e062e,0x628101b0,0x47857117,0x5c854089,0x85725e85,0x8001015e,0x628101fa,0x34850006, // 0a00 .______b_q_G_@___^r_^______b_._4
+0x85103a81,0x3a811734,0x2d17010e,0x16340a0c,0x0106178a,0x10063e81,0x9a810006,0x37080617, // 0a20 _:__4__:___-__4______>___._____7
+0x15231918,0x15183e81,0x18500a0d,0x22340e19,0x164b0a0b,0x0a0d1513,0x0a0b165a,0x00060159, // 0a40 __#__>____P___4"__K_____Z___Y__.
+0x0e063e81,0x15070622,0x0c301017,0x1518730a,0x34132e18,0x680a0b23,0xff070116,0x012a8aff, // 0a60 _>__"_____0__s___._4#__h______*_
+0x18195e8a,0x012a8a2e,0x16185e8a,0x012a8a2f,0x3e81178a,0x3e81010e,0x0e368110,0x891a8a01, // 0a80 _^__._*__^__/_*____>___>__6_____
+0x075c8540,0x5c852820,0x850e5e85,0x0601015e,0x824e8329,0x0a06019e,0x01167083,0x4e832906, // 0aa0 @___ (___^__^___)_N______p___)_N
+0x8001b480,0x121710fe,0x181d4006,0xfe800111,0x06121710,0x11181d80,0x10fe8001,0x01747983, // 0ac0 _________@___________________yt_
+0x0150014f,0x01520151,0x01540153,0x01560155,0x01580157,0x015a0159,0x015c015b,0x015e015d, // 0ae0 O_P_Q_R_S_T_U_V_W_X_Y_Z_[___]_^_
+0x0160015f,0x01620161,0x01640163,0x01660165,0x01680167,0x016a0169,0x016c016b,0x016e016d, // 0b00 __`_a_b_c_d_e_f_g_h_i_j_k_l_m_n_
+0x81474f43,0x819f801a,0x4fa8801a,0x16182d48,0x01270b0c,0x06150806,0x19231408,0x8206065c, // 0b20 COG________OH-____'_______#_____
+0x370b0bcf,0x00060116,0x4f43015a,0x5a000647,0x43151701,0x5a13474f,0x72160701,0x070efa80, // 0b40 ___7___.Z_COG_.Z___COG_Z___r____
+0xfe807216,0xb904070e,0x070e0281,0x06812505,0x81ab820e,0x0c301032,0x85097b0b,0x00000025, // 0b60 _r___________%______2_0__{__%...
+#if !FORTH_TURNKEY
+0x4e230000,0x0200504f,0x4524820b,0x00544958,0x258a0b04,0x45544e45,0x0b060052,0x59422393, // 0b80 ..#NOP.___$EXIT.___%ENTER.___#BY
+0x0b080045,0x4b3f249d,0x0a005945,0x4524a50b,0x0054494d,0x24ae0b0c,0x45545942,0xb70b0e00, // 0ba0 E.___$?KEY.___$EMIT.___$BYTE.___
+0x4c4f4425,0x10005449,0x4425c00b,0x5241564f,0xca0b1200,0x52425127,0x48434e41,0xd40b1400, // 0bc0 %DOLIT.___%DOVAR.___'QBRANCH.___
+0x41524226,0x0048434e,0x26e00b16,0x454e4f44,0x18005458,0x2824eb0b,0x00294f44,0x26f60b1a, // 0be0 &BRANCH.___&DONEXT.___$(DO).___&
+0x4f4f4c28,0x1c002950,0x2827ff0b,0x4f4f4c2b,0x1e002950,0x45270a0c,0x55434558,0x20004554, // 0c00 (LOOP).___'(+LOOP).___'EXECUTE. 
+0x2121160c,0x220c2200,0x00212b22,0x21280c24,0x0c260040,0x2143222f,0x350c2800,0x00404322, // 0c20 __!!."_""+!.$_(!@.&_/"C!.(_5"C@.
+0x223c0c2a,0x2c003e52,0x5222430c,0x0c2e0040,0x523e224a,0x510c3000,0x4f524424,0x0c320050, // 0c40 *_<"R>.,_C"R@.._J">R.0_Q$DROP.2_
+0x55442358,0x0c340050,0x57532461,0x36005041,0x4f24690c,0x00524556,0x23720c38,0x00544f52, // 0c60 X#DUP.4_a$SWAP.6_i$OVER.8_r#ROT.
+0x247b0c3a,0x4b434950,0x830c3c00,0x444e4123,0x8c0c3e00,0x00524f22,0x23940c40,0x00524f58, // 0c80 :_{$PICK.<__#AND.>__"OR.@__#XOR.
+0x269b0c42,0x45564e49,0x44005452,0x4c26a30c,0x46494853,0x0c460054,0x535226ae,0x54464948, // 0ca0 B__&INVERT.D__&LSHIFT.F__&RSHIFT
+0xb90c4800,0x4a002b21,0x2d21c40c,0xca0c4c00,0x4e002a21,0x2f21d00c,0xd60c5000,0x444f4d23, // 0cc0 .H__!+.J__!-.L__!*.N__!/.P__#MOD
+0xdc0c5200,0x47454e26,0x00455441,0x21e40c54,0x0c56003e,0x003d21ef,0x21f50c58,0x0c5a003c, // 0ce0 .R__&NEGATE.T__!>.V__!=.X__!<.Z_
+0x3e3022fb,0x010d5c00,0x003d3022,0x22080d5e,0x60003c30,0x31220f0d,0x0d62002b,0x2d312216, // 0d00 _"0>.___"0=.^__"0<.`__"1+.b__"1-
+0x1d0d6400,0x55443f24,0x0d660050,0x45442524,0x00485450,0x222d0d68,0x6a005052,0x4222370d, // 0d20 .d__$?DUP.f_$%DEPTH.h_-"RP.j_7"B
+0x0d6c004c,0x4543243e,0x6e004c4c,0x4123450d,0x70005342,0x4d234e0d,0x72005841,0x4d23560d, // 0d40 L.l_>$CELL.n_E#ABS.p_N#MAX.r_V#M
+0x74004e49,0x57265e0d,0x49485449,0x0d76004e,0x553e2666,0x52455050,0x710d7800,0x554f4325, // 0d60 IN.t_^&WITHIN.v_f&>UPPER.x_q%COU
+0x7a00544e,0x55227c0d,0x0d7c003c,0x4d552686,0x444f4d2f,0x8d0d7e00,0x2a4d5523,0x980d8000, // 0d80 NT.z_|"U<.|__&UM/MOD.~__#UM*.___
+0x002a4d22,0x23a00d82,0x002b4d55,0x25a70d84,0x4f4d2f2a,0x0d860044,0x4d2f24af,0x8800444f, // 0da0 "M*.___#UM+.___%*/MOD.___$/MOD._
+0x2a22b90d,0x0d8a002f,0x3e5323c2,0x0d8c0044,0x3e4423c9,0x0d8e0053,0x414424d1,0x90005342, // 0dc0 __"*/.___#S>D.___#D>S.___$DABS._
+0x4427d90d,0x4147454e,0x92004554,0x4422e20d,0x0d94002b,0x2d4422ee,0xf50d9600,0x2f445526, // 0de0 __'DNEGATE.___"D+.___"D-.___&UD/
+0x00444f4d,0x23fc0d98,0x003d3044,0x22070e9a,0x9f002132,0x32220f0e,0x0ea80040,0x44322416, // 0e00 MOD.___#D0=.___"2!.___"2@.___$2D
+0xb1005055,0x32251d0e,0x504f5244,0x260eb400,0x57533225,0xb7005041,0x3225300e,0x5245564f, // 0e20 UP.___%2DROP.__&%2SWAP.__0%2OVER
+0x3a0ebc00,0x4c454325,0xc3002b4c,0x4325440e,0x2d4c4c45,0x4e0ec600,0x4c454325,0xc900534c, // 0e40 .__:%CELL+.__D%CELL-.__N%CELLS._
+0x3222580e,0x0ecc002b,0x2d322262,0x690ed000,0x002a3222,0x22700ed4,0xd8002f32,0x5323770e, // 0e60 _X"2+.__b"2-.__i"2*.__p"2/.__w#S
+0xdc004050,0x49217e0e,0x860ede00,0xe0004a21,0x55268c0e,0x4f4f4c4e,0x0ee20050,0x454c2592, // 0e80 P@.__~!I.___!J.___&UNLOOP.___%LE
+0x00455641,0x259d0ee4,0x43415254,0x0ee60045,0x415324a7,0xe8004556,0x4c24b10e,0x0044414f, // 0ea0 AVE.___%TRACE.___$SAVE.___$LOAD.
+0x24ba0eea,0x4c4c4143,0xc30eec00,0x49542724,0x0eee0042,0x414224cc,0xf2004553,0x4322d50e, // 0ec0 ___$CALL.___$'TIB.___$BASE.___"C
+0x0ef60050,0x4f4327de,0x5845544e,0x0efa0054,0x414c24e5,0xfe005453,0x2725f10e,0x45444f4d, // 0ee0 P.___'CONTEXT.___$LAST.___%'MODE
+0xfa0e0201,0x42412726,0x0154524f,0x23040f06,0x01444c48,0x240f0f0a,0x4e415053,0x170f0e01, // 0f00 ____&'ABORT____#HLD____$SPAN____
+0x4e493e23,0x200f1201,0x49542324,0x0f160142,0x6d742328,0x0f1a0170,0x50532331,0x0f1e0130, // 0f20 #>IN___ $#TIB___(#tmp___1#SP0___
+0x49542439,0x22013042,0x2f24410f,0x01424954,0x224a0f26,0x2a01504e,0x2724530f,0x01524448, // 0f40 9$TIB0_"_A$/TIB_&_J"NP_*_S$'HDR_
+0x255a0f2e,0x4f4f4227,0x0f320154,0x55432763,0x4e455252,0x0f360154,0x4f56286d,0x494c2d43, // 0f60 ._Z%'BOOT_2_c'CURRENT_6_m(VOC-LI
+0x3a014b4e,0x2726790f,0x4544524f,0x0f3e0152,0x54272586,0x014c4941,0x24910f42,0x54494c27, // 0f80 NK_:_y&'ORDER_>__%'TAIL_B__$'LIT
+0x9b0f4601,0x01305322,0x23a40f4a,0x0159454b,0x25ab0f4e,0x4148433e,0x0f530152,0x454824b3, // 0fa0 _F__"S0_J__#KEY_N__%>CHAR_S__$HE
+0x62014552,0x5023bd0f,0x66014441,0x5423c60f,0x6e014249,0x4325ce0f,0x45564f4d,0xd60f7201, // 0fc0 RE_b__#PAD_f__#TIB_n__%CMOVE_r__
+0x564f4d24,0x0f840145,0x494624e0,0x9a014c4c,0x4425e90f,0x54494749,0xf20faa01,0x4c4f4824, // 0fe0 $MOVE____$FILL____%DIGIT____$HOL
+0x0fb60144,0x233c22fc,0x0510c001,0x47495324,0x10c6014e,0x5845270c,0x43415254,0x10cf0154, // 1000 D____"<#____$SIGN____'EXTRACT___
+0x01232115,0x222110d8,0xe0015323,0x23222710,0x10ee013e,0x5344242e,0xf8015254,0x53233510, // 1020 _!#___!"#S___'"#>___.$DSTR___5#S
+0x07025254,0x48233e10,0x0b025845,0x44274610,0x4d494345,0x11024c41,0x44264e10,0x54494749, // 1040 TR___>#HEX___F'DECIMAL___N&DIGIT
+0x1017023f,0x554e275a,0x5245424d,0x102f023f,0x50532565,0x02454341,0x25711088,0x52414843, // 1060 ?___Z'NUMBER?_/_e%SPACE___q%CHAR
+0x108b0253,0x5053267b,0x53454341,0x85109a02,0x50595424,0x109e0245,0x52432290,0x9910ab02, // 1080 S___{&SPACES____$TYPE____"CR____
+0x246f6423,0xa010b202,0x7c222423,0xa810bc02,0x7c222e23,0xb010bf02,0x02522e22,0x23b810c4, // 10a0 #do$____#$"|____#."|____".R____#
+0x02522e55,0x22bf10cf,0xdf022e55,0x2e21c710,0xce10e402,0xeb023f21,0x2827d410,0x73726170, // 10c0 U.R____"U.____!.____!?____'(pars
+0xef022965,0x5025da10,0x244b4341,0xe6104303,0x52415025,0x4e034553,0x5425f010,0x4e454b4f, // 10e0 e)____%PACK$_C__%PARSE_N__%TOKEN
+0xfa106303,0x524f5724,0x11700344,0x414e2504,0x033e454d,0x250d1179,0x454d4153,0x118a033f, // 1100 _c__$WORD_p__%NAME>_y__%SAME?___
+0x49462417,0xb203444e,0x4e252111,0x3f454d41,0x2a110904,0x04485e22,0x23341134,0x04504154, // 1120 _$FIND___!%NAME?___*"^H_4_4#TAP_
+0x243b1147,0x5041546b,0x43114d04,0x43434126,0x04545045,0x264c1168,0x45505845,0x8a045443, // 1140 G_;$kTAP_M_C&ACCEPT_h_L&EXPECT__
+0x51255711,0x59524555,0x62119104,0x4f424125,0xa2045452,0x3f266c11,0x43415453,0x11ab044b, // 1160 _W%QUERY___b%ABORT___l&?STACK___
+0x52452576,0x04524f52,0x2a8111ad,0x544e4924,0x52505245,0xb9045445,0x5ba18b11,0x9a11e604, // 1180 v%ERROR____*$INTERPRET_____[____
+0x4b4f2e23,0xa011ed04,0x41564524,0x110e054c,0x555124a8,0x25055449,0x2c21b111,0xba113405, // 11a0 #.OK____$EVAL____$QUIT_%__!,_4__
+0x052c4322,0x25c0113e,0x4f4c4c41,0x11470554,0x4f4328c7,0x4c49504d,0x4b052c45,0x4ca7d111, // 11c0 "C,_>__%ALLOT_G__(COMPILE,_K___L
+0x52455449,0x5c054c41,0x4327de11,0x49504d4f,0x5e05454c,0x4927ea11,0x4e494c4e,0x66052c45, // 11e0 ITERAL____'COMPILE_^__'INLINE,_f
+0x2428f611,0x504d4f43,0x05454c49,0x27021268,0x494e553f,0x05455551,0x230f12ae,0x05682c24, // 1200 __($COMPILE_h__'?UNIQUE____#$,h_
+0x231b12c8,0x056e2c24,0x212312ec,0x12100627,0x065d212b,0xa931121a,0x4d4f435b,0x454c4950, // 1220 ___#$,n___#!'___+!]___1_[COMPILE
+0x122a065d,0x063a2137,0xa145122f,0x1236063b,0x5845a44b,0x44065449,0x4ea65112,0x4941544f, // 1240 ]_*_7!:_/_E_;_6_K_EXIT_D_Q_NOTAI
+0x1249064c,0x4552a75a,0x53525543,0x124f0645,0x3e282765,0x454d414e,0x12570629,0x4e3e2571, // 1260 L_I_Z_RECURSE_O_e'(>NAME)_W_q%>N
+0x06454d41,0x237d126b,0x0644492e,0x24871293,0x504d5544,0x8f12a206,0x524f5725,0xf5065344, // 1280 AME_k_}#.ID____$DUMP____%WORDS__
+0x46269812,0x4547524f,0x122b0754,0x45482aa2,0x52454441,0x5353454c,0xad126507,0x41454827, // 12a0 __&FORGET_+__*HEADERLESS_e__'HEA
+0x53524544,0xbc126c07,0x55525025,0x7207454e,0x5328c812,0x5350414e,0x07544f48,0x27d21274, // 12c0 DERS_l__%PRUNE_r__(SNAPSHOT_t__'
+0x54534552,0x0745524f,0x25df1276,0x4444412e,0x12780752,0x4f2e23eb,0x12810750,0x455323f5, // 12e0 RESTORE_v__%.ADDR_x__#.OP____#SE
+0x12910845,0x4841a5fd,0x08444145,0xa50513ac,0x49414741,0x13b6084e,0x4542a50f,0x084e4947, // 1300 E_____AHEAD_____AGAIN_____BEGIN_
+0xa51913bc,0x49544e55,0x13c4084c,0x4649a223,0x2d13ca08,0x454854a4,0x13d4084e,0x4c45a434, // 1320 ____UNTIL___#_IF___-_THEN___4_EL
+0xe2084553,0x57a53d13,0x454c4948,0x4613e808,0x454857a4,0x13ec084e,0x4552a650,0x54414550, // 1340 SE___=_WHILE___F_WHEN___P_REPEAT
+0x5913f008,0x524f46a3,0x6413f508,0x544641a3,0x6c13fb08,0x58454ea4,0x13020954,0x4f44a274, // 1360 ___Y_FOR___d_AFT___l_NEXT___t_DO
+0x7d130809,0x4f4f4ca4,0x13140950,0x4c2ba584,0x09504f4f,0x238d131c,0x09222c24,0xa2971324, // 1380 ___}_LOOP_____+LOOP____#$,"_$___
+0x2e092224,0x2ea29f13,0x13370922,0x4f4324a6,0x40094544,0x4326ad13,0x54414552,0x134c0945, // 13a0 $"_.___."_7__$CODE_@__&CREATE_L_
+0x4f4425b6,0x093e5345,0x28c11355,0x49524156,0x454c4241,0xcb137109,0x4e4f4328,0x4e415453, // 13c0 _%DOES>_U__(VARIABLE_q__(CONSTAN
+0x13780954,0x563229d8,0x41495241,0x09454c42,0x29e5138e,0x4e4f4332,0x4e415453,0x13980954, // 13e0 T_x__)2VARIABLE____)2CONSTANT___
+0x542824f3,0xb009294f,0x56250114,0x45554c41,0x0a14c909,0x094f54a2,0xa31414dd,0x094f542b, // 1400 _$(TO)____%VALUE_____TO_____+TO_
+0x251b14e6,0x45464544,0x14ef0952,0x5349a223,0x2d14fe09,0x52414d26,0x0a52454b,0x2e341406, // 1420 ___%DEFER___#_IS___-&MARKER___4.
+0x54524f46,0x4f572d48,0x494c4452,0x170a5453,0x57283f14,0x4c44524f,0x0a545349,0x2952141a, // 1440 FORTH-WORDLIST___?(WORDLIST___R)
+0x2d544553,0x4544524f,0x142a0a52,0x4547295f,0x524f2d54,0x0a524544,0x246d145e,0x594c4e4f, // 1460 SET-ORDER_*__)GET-ORDER_^_m$ONLY
+0x7b147a0a,0x534c4124,0x14800a4f,0x52502884,0x4f495645,0x880a5355,0x46258d14,0x4854524f, // 1480 _z_{$ALSO____(PREVIOUS____%FORTH
+0x9a14900a,0x4645442b,0x54494e49,0x534e4f49,0xa414960a,0x434f562a,0x4c554241,0x0a595241, // 14a0 ____+DEFINITIONS____*VOCABULARY_
+0xa2b4149d,0xaf0a282e,0x5ca1c314,0xca14b60a,0xbc0a28a1,0x432cd014,0x49504d4f,0x4f2d454c, // 14c0 ____.(___________(____,COMPILE-O
+0x0a594c4e,0x29d614c3,0x454d4d49,0x54414944,0x14ce0a45,0x4e4926e7,0x454e494c,0xf514d90a, // 14e0 NLY____)IMMEDIATE____&INLINE____
+0x4f4c4325,0xe00a4b43,0x50270015,0x4f4d4e49,0xe20a4544,0x4d230a15,0xe40a5041,0x49221615, // 1500 %CLOCK___.'PINMODE____#MAP____"I
+0x15e60a4e,0x554f231e,0x15e80a54,0x49412325,0x15ea0a4e,0x5750232d,0x15ec0a4d,0x4d542535, // 1520 N____#OUT___%#AIN___-#PWM___5%TM
+0x0a525349,0x253d15ee,0x53494350,0x15f00a52,0x49542547,0x0a52454d,0x255115f2,0x4e494350, // 1540 ISR___=%PCISR___G%TIMER___Q%PCIN
+0x15f40a54,0x4353255b,0x0a444548,0x266515f6,0x434e4143,0xf80a4c45,0x49246f15,0x0a54414c, // 1560 T___[%SCHED___e&CANCEL___o$ILAT_
+0x257a15fa,0x54414c49,0x15fc0a30,0x57482383,0x15fe0a4d,0x4154248d,0x000b4b53,0x51279515, // 1580 __z%ILAT0____#HWM____$TASK_.__'Q
+0x544e4155,0x020b4d55,0x43239e15,0x040b5550,0x4224aa15,0x0b4b4e41,0x24b21506,0x40524146, // 15a0 UANTUM____#CPU____$BANK____$FAR@
+0xbb15080b,0x52414624,0x150a0b21,0x414625c4,0x0b404352,0x25cd150c,0x43524146,0x150e0b21, // 15c0 ____$FAR!____%FARC@____%FARC!___
+0x463e24d7,0x100b5241,0x4624e115,0x0b3e5241,0x24ea1512,0x50414548,0xf315140b,0x4c4c4128, // 15e0 _$>FAR____$FAR>____$HEAP____(ALL
+0x5441434f,0x15160b45,0x524624fc,0x180b4545,0x52260916,0x5a495345,0x161a0b45,0x52412a12, // 1600 OCATE____$FREE____&RESIZE____*AR
+0x2d414e45,0x4b52414d,0x1d161c0b,0x4552412d,0x522d414e,0x41454c45,0x1e0b4553,0x44252c16, // 1620 ENA-MARK____-ARENA-RELEASE___,%D
+0x59414c45,0x3e16200b,0x4c492e25,0x340b5441,0x41274816,0x49542d54,0x460b454d,0x41255216, // 1640 ELAY_ _>%.ILAT_4_H'AT-TIME_F_R%A
+0x52455446,0x5e164a0b,0x45564525,0x510b5952,0x43246816,0x0b444c4f,0x00000059,0x00000000, // 1660 FTER_J_^%EVERY_Q_h$COLD_Y.......
+0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000, // 1680 ................................
+#endif // !FORTH_TURNKEY
 };
@@ -10,6 +10,9 @@
  */
 #include "eforth_vm.h"
 #include "eforth_opcode.h"
+#if JIT_X64
+#include "eforth_jit.h"
+#endif // JIT_X64
 
 namespace EfVM {
 ///
@@ -19,6 +22,35 @@ DU    *S;              ///< data stack pointer,   'stack' in Dr. Ting's
 DU    *R;              ///< return stack pointer, 'rack'  in Dr. Ting's
 DU    T;               ///< TOS, cached top of stack value
 DU    I;               ///< RTOS, cached loop counter on return stack
+DU    *SP0;            ///< base of current data stack
+DU    *RP0;            ///< top of current return stack
+DU    *SPZ;            ///< data/return stack split (0: both share one block)
+///@}
+///@name Interrupt Context (foreground registers saved on ISR entry)
+///@{
+DU    *fS, *fR, *fSP0, *fRP0, *fSPZ;
+DU    fT, fI;
+IU    fIP;             ///< foreground ip (resumed if ISR faults)
+///@}
+///@name Task Control (instruction count time slicing)
+///@{
+typedef struct {
+    DU    *S, *R;      ///< saved stack pointers (0: free slot)
+    DU    *SP0, *RP0;  ///< stack base and top
+    DU    *SPZ;        ///< stack split (0: shared block)
+    U32   ops;         ///< instructions executed (CPU accounting)
+} Task;
+Task  _task[TASK_MAX]; ///< task 0 is the main (console) task
+U8    _tid;            ///< current task id
+U16   _qmax;           ///< time slice quantum (0: preemption off)
+U16   _qcnt;           ///< instructions used in current slice
+///@}
+///@name Heap (pool blocks carved down from top, arena bumps up from bottom)
+///@{
+IU    _hp0, _hp1;      ///< heap region [_hp0, _hp1)
+IU    _abot;           ///< top of arena, grows up
+IU    _ptop;           ///< bottom of pool, grows down
+IU    _pfree;          ///< pool free list (0: empty)
 ///@}
 ///@name IO Streaming interface
 ///@{
@@ -30,16 +62,627 @@ PGM_P _rom;            ///< ROM, Forth built-in words stored in Flash
 U8    *_ram;           ///< RAM, for user defined words
 U8    *_pre;           ///< Forth code pre-defined/embedded in .ino
 CFP   _api[CFUNC_MAX]; ///< C API function pointer
+U8    *_far;           ///< far memory, outside of VM address space
+U32   _far_sz;         ///< size of far memory (0: none)
+U16   _bank;           ///< current 64K bank of far memory
 ///@}
+///@name Memory Layout (set by vm_init, defaults in eforth_config.h)
+///@{
+IU    _ds;             ///< data stack (grows up)
+IU    _rs;             ///< return stack (grows down from _istk), top of _ds
+IU    _istk;           ///< ISR data/return stack area, top of _rs
+IU    _tib;            ///< terminal input buffer, top of _istk
+IU    _roof;           ///< end of RAM, top of _tib
+///@}
+#if XLAT_CACHE
+///@name Translation Cache (host, one slot per VM address)
+///@{
+typedef struct {
+    IU    arg;         ///< operand, i.e. literal, branch or call target
+    U8    op;          ///< opcode, colon call decoded as ENTER
+    U8    n;           ///< instruction length (0: not decoded yet)
+} Xop;
+Xop   _xc[FORTH_MEM_SZ]; ///< decoded ops, indexed by address
+///@}
+#endif // XLAT_CACHE
 ///
 ///> Forth Virtual Machine primitive functions
 ///
+void _paint(IU a0, IU a1) {           ///> fill stack area with STK_MARK
+    for (DU *p=(DU*)RAM(a0); p < (DU*)RAM(a1); p++) *p = (DU)STK_MARK;
+}
+///
+///> high-water mark (in cells) of stack n
+///> 0:data, 1:return, 2:ISR data, 3:ISR return
+///
+DU _hwm(U8 n) {
+    DU *b = (DU*)RAM(n==0 ? _ds : n==1 ? _rs   : _istk);
+    DU *t = (DU*)RAM(n==0 ? _rs : n==1 ? _istk : _tib);
+    DU *p;
+    if (n & 1) {                      /// * return stack grows down
+        for (p = t; p > b && *(p-1) != (DU)STK_MARK; p--);
+        return (DU)(t - p);
+    }
+    for (p = b; p < t && *p != (DU)STK_MARK; p++);
+    return (DU)(p - b);               /// * data stack grows up
+}
+///
+///> switch to ISR stacks (foreground stacks are left untouched)
+///
+inline void _isr_enter(IU ip) {
+    fS = S; fR = R; fT = T; fI = I; fSP0 = SP0; fRP0 = RP0; fSPZ = SPZ;
+    fIP = ip;
+    SP0 = (DU*)RAM(_istk);
+    RP0 = (DU*)RAM(_tib);
+    SPZ = 0;                          /// * ISR stacks share one block
+    S   = SP0 - 1;
+    R   = RP0;
+    T   = 0;
+}
+///
+///> restore foreground stacks (ISR leftovers are discarded)
+///
+inline void _isr_leave() {
+    S = fS; R = fR; T = fT; I = fI; SP0 = fSP0; RP0 = fRP0; SPZ = fSPZ;
+}
+
+///
+///> resume next live task, unwind its frame (ip, I on R; T on S)
+///
+IU _resume() {
+    do {                              /// * task 0 never retires
+        _tid = (_tid + 1) % TASK_MAX;
+    } while (!_task[_tid].S);
+    Task *t = &_task[_tid];
+    S = t->S; R = t->R; SP0 = t->SP0; RP0 = t->RP0; SPZ = t->SPZ;
+    IU ip = (IU)*R++;                 /// * same frame as IRET
+    RPOP();
+    POP();
+    return ip;
+}
+///
+///> slice expired, save current task frame then switch
+///
+IU _yield(IU ip) {
+    Task *t = &_task[_tid];
+    t->ops += _qcnt;                  /// * CPU accounting
+    _qcnt   = 0;
+    *++S = T;                         /// * keep T on data stack
+    RPUSH(ip);                        /// * keep I and ip on return stack
+    *--R = I;
+    t->S = S; t->R = R; t->SP0 = SP0; t->RP0 = RP0; t->SPZ = SPZ;
+    return _resume();
+}
+///
+///> task returned from its xt, free the slot
+///
+IU _task_end() {
+    _task[_tid].ops += _qcnt;
+    _task[_tid].S    = 0;
+    _qcnt = 0;
+    return _resume();
+}
+///
+///> stack fault, an ISR is dropped, a task retired, the console restarts 'ABORT
+///
+IU _stk_fault(IU ir) {                ///> caller clears ir (ISR dropped)
+    LOG(S < SP0 - 1 ? " stack underflow\r\n" : " stack overflow\r\n");
+    if (ir) {                         /// * resume foreground
+        _isr_leave();
+        return fIP;
+    }
+    if (_tid) return _task_end();
+    S = SP0 - 1;  R = RP0;            /// * clear both stacks
+    T = I = 0;
+    IU xt = GET(FORTH_UVAR_ADDR + CELLSZ*6);
+    return xt ? xt : GET(FORTH_BOOT_ADDR);
+}
+///
+///> create a task running xt on stack area [a, a+n)
+///> data stack grows up from a, return stack down from a+n
+///
+DU _task_add(IU xt, IU a, IU n) {
+    for (U8 i=1; i < TASK_MAX; i++) {
+        Task *t = &_task[i];
+        if (t->S) continue;           /// * slot in use
+        t->SP0 = (DU*)RAM(a);
+        t->RP0 = (DU*)RAM(a + (n & ~(CELLSZ-1)));
+        t->SPZ = 0;                   /// * both stacks share [a, a+n)
+        t->S   = t->SP0;
+        t->R   = t->RP0;
+        *t->S  = 0;                   /// * T
+        *--t->R = IRET_FLAG;          /// * I, returning to 0 retires the task
+        *--t->R = xt;                 /// * ip
+        t->ops = 0;
+        return i;
+    }
+    return 0;                         /// * no free slot
+}
+///
+///> instructions executed by task i
+///
+U32 _task_ops(U8 i) {
+    return i < TASK_MAX ? _task[i].ops + (i==_tid ? _qcnt : 0) : 0;
+}
+
+///
+///> far memory pointer of bank:a for n bytes (0: out of range)
+///
+U8 *_fptr(IU a, IU n) {
+    U32 fa = ((U32)_bank << 16) + a;
+    return (fa < _far_sz && n <= _far_sz - fa) ? &_far[fa] : 0;
+}
+
+#if XLAT_CACHE
+///
+///> translation cache, each op decoded once along with its inline operand
+///> stores (SET, BSET) drop the slots they overlap, LOAD flushes all
+///
+#define OP(name) xc##name
+enum { xcNOP = 0, OPCODES };
+#undef OP
+void _xdecode(IU ip) {                ///> decode op at ip into its slot
+    Xop &x = _xc[ip & (FORTH_MEM_SZ-1)];
+    U8  op = BGET(ip);
+    x.op  = op;
+    x.n   = 1;
+    x.arg = 0;
+    if (op & fCOLON8) {               /// * colon call, token is high-byte first
+        IU xt = op & 0x7f;
+        for (int i=1; i < CELLSZ; i++) xt = (xt << 8) | BGET(ip + i);
+        x.op  = xcENTER;
+        x.n   = CELLSZ;
+        x.arg = xt;
+        return;
+    }
+    switch (op) {
+    case xcENTER: x.op = xcNOP; break;   /// * bare opENTER does nothing
+    case xcBYTE:  x.n = 2; x.arg = BGET(ip + 1); break;
+    case xcDOLIT:
+    case xcBRAN:
+    case xcQBRAN:
+    case xcDONEXT:
+    case xcDODO:
+    case xcDOLOOP:
+    case xcDOPLOOP: x.n = 1 + CELLSZ; x.arg = GET(ip + 1); break;
+    }
+}
+#endif // XLAT_CACHE
+#if XLAT_CACHE || JIT_X64
+void _xinv(IU d, IU n) {              ///> drop decoded ops and native code overlapping [d, d+n)
+#if XLAT_CACHE
+    for (IU i = 0; i < n + CELLSZ; i++) {
+        Xop &x = _xc[(d - CELLSZ + i) & (FORTH_MEM_SZ-1)];
+        if (i >= CELLSZ || x.n > CELLSZ - i) x.n = 0;
+    }
+#endif // XLAT_CACHE
+#if JIT_X64
+    jit_inv(d, n);
+#endif // JIT_X64
+}
+void _xflush() {                      ///> dictionary replaced
+#if XLAT_CACHE
+    memset(_xc, 0, sizeof(_xc));
+#endif // XLAT_CACHE
+#if JIT_X64
+    jit_flush();
+#endif // JIT_X64
+}
+#define XFLUSH()  _xflush()
+#else  // !(XLAT_CACHE || JIT_X64)
+#define XFLUSH()
+#endif // XLAT_CACHE || JIT_X64
+#if JIT_X64
+#define NATIVE(ip) if (!_qmax) ip = jit_exec(ip)  /**< colon word to native code */
+void _jset(IU a, DU v, U8 b) {        ///> stores of native code, b 0: !, 1: C!, 2: +!
+    if (b == 1) BSET(a, v);
+    else        SET(a, b ? (DU)GET(a) + v : v);
+}
+#elif AOT
+IU aot_exec(IU xt);                   ///< run ROM word xt compiled ahead of time (eforth_aot.h)
+#define NATIVE(ip) if (!_qmax) ip = aot_exec(ip)  /**< ROM word to its C function */
+#else  // !JIT_X64 && !AOT
+#define NATIVE(ip)
+#endif // JIT_X64
+///
+///> heap allocator, constant time except the copy in _resize
+///> pool: FORTH_POOL_BLK blocks, freed one by one onto a free list
+///> arena: larger blocks with a size header, freed in bulk by ARENA-RELEASE
+///
+#define ALIGN(n) (((n) + CELLSZ-1) & ~(IU)(CELLSZ-1))
+void _heap(IU a, IU n) {              ///> (re)initialize heap on [a, a+n)
+    IU e  = (a + n) & ~(IU)(CELLSZ-1);
+    _hp0  = _abot = ALIGN(a);
+    _hp1  = _ptop = e > _hp0 ? e : _hp0;
+    _pfree = 0;
+}
+IU _arena(IU n) {                     ///> bump n bytes off arena (0: full)
+    n = ALIGN(n);
+    if (n + CELLSZ > (IU)(_ptop - _abot)) return 0;
+    SET(_abot, n);                    /// * size header for RESIZE
+    IU a  = _abot + CELLSZ;
+    _abot = a + n;
+    return a;
+}
+IU _alloc(IU n) {                     ///> allocate n bytes (0: out of memory)
+    if (n > FORTH_POOL_BLK) return _arena(n);
+    IU a = _pfree;
+    if (a) { _pfree = GET(a); return a; }
+    if ((IU)(_ptop - _abot) < FORTH_POOL_BLK) return 0;
+    return _ptop -= FORTH_POOL_BLK;
+}
+DU _free(IU a) {                      ///> free block a (ior 0: ok)
+    if (a >= _ptop && a < _hp1 && !((_hp1 - a) & (FORTH_POOL_BLK-1))) {
+        SET(a, _pfree);               /// * pool block onto free list
+        _pfree = a;
+        return 0;
+    }
+    return (a >= _hp0 && a < _abot) ? 0 : -1; /// * arena block, kept until released
+}
+IU _resize(IU a, IU n) {              ///> resize block a to n bytes (0: failed, a kept)
+    IU sz;
+    if (a >= _ptop && a < _hp1) {     /// * pool block
+        if (n <= FORTH_POOL_BLK) return a;
+        sz = FORTH_POOL_BLK;
+    }
+    else {                            /// * arena block
+        sz = GET(a - CELLSZ);
+        IU n1 = ALIGN(n);
+        if (a + sz == _abot && n1 <= (IU)(_ptop - a)) {
+            SET(a - CELLSZ, n1);      /// * top of arena, resize in place
+            _abot = a + n1;
+            return a;
+        }
+        if (n1 <= sz) return a;       /// * shrink in place
+    }
+    IU a1 = _alloc(n);
+    if (!a1) return 0;
+    for (IU i=0; i < sz && i < n; i++) BSET(a1 + i, BGET(a + i));
+    _free(a);
+    return a1;
+}
+
+///
+///> Name space (headers kept apart from code, below top of dictionary)
+///
+void _unlink(IU a) {                  ///> unlink RAM headers in name space from wordlist a
+    for (IU n = GET(a); n >= FORTH_RAM_ADDR; n = GET(a)) {
+        if (BGET(n) & fHDR) SET(a, GET(n - CELLSZ)); /// * skip separated header
+        else a = n - CELLSZ;                      /// * keep inline header, follow link
+    }
+}
+void _prune() {                       ///> unlink name space headers from all wordlists
+    _unlink(FORTH_UVAR_ADDR + CELLSZ*3);          /// * FORTH, i.e. CONTEXT
+    for (IU w = GET(FORTH_UVAR_ADDR + CELLSZ*19); w; w = GET(w + CELLSZ)) {
+        _unlink(w);                               /// * VOC-LINK chain
+    }
+    SET(FORTH_UVAR_ADDR + CELLSZ*4,  GET(GET(FORTH_UVAR_ADDR + CELLSZ*18)));  /// * LAST
+    SET(FORTH_UVAR_ADDR + CELLSZ*15, _ds - FORTH_HEAP_SZ);                    /// * NP, name space emptied
+}
+
+///
+///> inliner, $COMPILE copies the body of a short colon word in place of the call
+///>   auto: body up to FORTH_INLINE_SZ bytes (flattened), no branches,
+///>         return stack or ip bound ops, callees inlinable too
+///>   INLINE flagged (leading bare opENTER): up to FORTH_INLINE_MAX bytes,
+///>         return stack ops and branches (relocated) allowed, callees kept
+///>         as calls when not inlinable, so no inline strings
+///
+#define OP(name) in##name
+enum { inNOP = 0, OPCODES };
+#undef OP
+#define UVAR_CP   (FORTH_UVAR_ADDR + CELLSZ*2)
+#define UVAR_TAIL (FORTH_UVAR_ADDR + CELLSZ*(20+ORDER_MAX))
+#define UVAR_LIT  (FORTH_UVAR_ADDR + CELLSZ*(21+ORDER_MAX))
+#define BRANCH(op) ((op)==inBRAN || (op)==inQBRAN || (op)==inDONEXT || \
+                    ((op) >= inDODO && (op) <= inDOPLOOP))
+IU _op_sz(IU a) {                     ///> size of op at a, with its operand
+    U8 op = BGET(a);
+    if (op & fCOLON8) return CELLSZ;
+    return op==inBYTE ? 2 : (op==inDOLIT || BRANCH(op)) ? 1+CELLSZ : 1;
+}
+IU _op_xt(IU a) {                     ///> callee of colon call at a, high-byte first
+    IU xt = BGET(a) & 0x7f;
+    for (int i=1; i < CELLSZ; i++) xt = (xt << 8) | BGET(a + i);
+    return xt;
+}
+IU _body_end(IU a, IU e) {            ///> closing EXIT of body at a (0: none before e)
+    for (IU f = a; a < e; a += _op_sz(a)) {
+        U8 op = BGET(a);
+        if (op == inEXIT && a >= f) return a;      /// * not jumped over
+        if (BRANCH(op) && GET(a + 1) > f) f = GET(a + 1);
+    }
+    return 0;
+}
+///
+///> literal folding, 'LIT keeps the last literal compiled and the one right
+///> before it, an ALU op compiled right after them is evaluated on the spot
+///> (BEGIN, THEN and ] clear 'LIT as HERE can be a branch target)
+///
+U8 _is_lit(IU l, IU h) {              ///> a literal at l ends at h
+    if (!l) return 0;
+    U8 op = BGET(l);
+    IU sz = op==inBYTE ? 2 : op==inDOLIT ? 1+CELLSZ : (op==inCELL || op==inBL) ? 1 : 0;
+    return sz && l + sz == h;
+}
+DU _lit_v(IU l) {                     ///> value of literal at l
+    switch (BGET(l)) {
+    case inBYTE:  return BGET(l + 1);
+    case inDOLIT: return GET(l + 1);
+    case inCELL:  return CELLSZ;
+    }
+    return 0x20;                      /// * BL
+}
+void _lit_mark(IU h) {                ///> literal at h, the one before kept when adjacent
+    IU l = GET(UVAR_LIT);
+    SET(UVAR_LIT + CELLSZ, _is_lit(l, h) ? l : 0);
+    SET(UVAR_LIT, h);
+}
+IU _lit(IU h, DU v) {                 ///> compile literal v at h, returns address after it
+    _lit_mark(h);
+    if (!(v & -0x100)) {              /// * 8-bit literal
+        BSET(h, inBYTE);
+        BSET(h + 1, (U8)v);
+        return h + 2;
+    }
+    BSET(h, inDOLIT);
+    SET(h + 1, v);
+    return h + 1 + CELLSZ;
+}
+int _fold(U8 op, DU a, DU b, DU *r) { ///> r = a op b, returns number of operands (0: not folded)
+    switch (op) {
+    case inONEP:  *r = b + 1;             return 1;
+    case inONEM:  *r = b - 1;             return 1;
+    case inNEG:   *r = -b;                return 1;
+    case inINV:   *r = b ^ -1;            return 1;
+    case inABS:   *r = abs(b);            return 1;
+    case inZGT:   *r = BOOL(b > 0);       return 1;
+    case inZEQ:   *r = BOOL(b == 0);      return 1;
+    case inZLT:   *r = BOOL(b < 0);       return 1;
+    case inADD:   *r = a + b;             return 2;
+    case inSUB:   *r = a - b;             return 2;
+    case inMUL:   *r = a * b;             return 2;
+    case inDIV:   if (b <= 0) return 0;   /// * run time decides 0 and -1
+                  *r = a / b;             return 2;
+    case inMOD:   if (b <= 0) return 0;
+                  *r = a % b;             return 2;
+    case inAND:   *r = a & b;             return 2;
+    case inOR:    *r = a | b;             return 2;
+    case inXOR:   *r = a ^ b;             return 2;
+    case inLSH:   *r = a << b;            return 2;
+    case inRSH:   *r = a >> b;            return 2;
+    case inGT:    *r = BOOL(a > b);       return 2;
+    case inEQ:    *r = BOOL(a == b);      return 2;
+    case inLT:    *r = BOOL(a < b);       return 2;
+    case inULESS: *r = BOOL((UDU)a < (UDU)b); return 2;
+    case inMAX:   *r = a > b ? a : b;     return 2;
+    case inMIN:   *r = a < b ? a : b;     return 2;
+    }
+    return 0;
+}
+IU _op(IU h, U8 op) {                 ///> compile op at h, folded with literals before it
+    IU l = GET(UVAR_LIT), l0 = GET(UVAR_LIT + CELLSZ);
+    DU r;
+    if (_is_lit(l, h)) {
+        int n = _fold(op, 0, _lit_v(l), &r);
+        if (n == 1) {                 /// * n op => n'
+            SET(UVAR_LIT, l0);
+            return _lit(l, r);
+        }
+        if (n == 2 && _is_lit(l0, l)) {  /// * n1 n2 op => n'
+            _fold(op, _lit_v(l0), _lit_v(l), &r);
+            SET(UVAR_LIT, 0);
+            return _lit(l0, r);
+        }
+    }
+    if (op == inCELL || op == inBL) _lit_mark(h);
+    BSET(h, op);
+    return h + 1;
+}
+void _litc(DU v) { SET(UVAR_CP, _lit(GET(UVAR_CP), v)); }  ///> LITERAL
+void _opc(U8 op) { SET(UVAR_CP, _op(GET(UVAR_CP), op)); }  ///> $COMPILE a primitive
+///
+///> constant and variable words compile as literals
+///
+U8 _is_const(IU xt) {                 ///> CONSTANT, [DOLIT][xt+CELLSZ+3][AT][EXIT][n]
+    return BGET(xt) == inDOLIT && (IU)GET(xt + 1) == xt + CELLSZ + 3 &&
+        BGET(xt + 1 + CELLSZ) == inAT && BGET(xt + 2 + CELLSZ) == inEXIT;
+}
+U8 _is_var(IU xt) {                   ///> VARIABLE or CREATE without DOES>, [DOVAR][EXIT]
+    return xt >= FORTH_DIC_ADDR && BGET(xt) == inDOVAR && BGET(xt + 1) == inEXIT;
+}
+U8 _is_value(IU xt) {                 ///> VALUE, [DOLIT][a][AT][EXIT], cell a before xt
+    return BGET(xt) == inDOLIT && (IU)GET(xt + 1) < xt &&
+        BGET(xt + 1 + CELLSZ) == inAT && BGET(xt + 2 + CELLSZ) == inEXIT;
+}
+U8 _is_defer(IU xt) {                 ///> DEFER, [BRAN][target][EXIT]
+    return BGET(xt) == inBRAN && BGET(xt + 1 + CELLSZ) == inEXIT;
+}
+int _inline(IU xt, int d) {           ///> size of body of xt inlined, -1: not inlinable
+    if (_is_const(xt)) return (GET(xt + CELLSZ + 3) & -0x100) ? 1+CELLSZ : 2;
+    if (_is_var(xt))   return ((xt + 2) & -0x100) ? 1+CELLSZ : 2;
+    U8 x = BGET(xt) == inENTER;       /// * INLINE flagged
+    IU a = xt + x;
+    IU e = d < 4 ? _body_end(a, a + FORTH_INLINE_MAX) : 0;
+    if (!e) return -1;
+    U8 br = 0;
+    for (IU p = a; p < e; p += _op_sz(p)) {
+        U8 op = BGET(p);
+        if (!BRANCH(op)) continue;
+        IU t = GET(p + 1);
+        if (!x || t < a || t > e) return -1; /// * only flagged, and within body
+        br = 1;
+    }
+    int n = 0;
+    for (IU p = a; p < e; p += _op_sz(p)) {
+        U8 op = BGET(p);
+        if (op & fCOLON8) {
+            int m = br ? -1 : _inline(_op_xt(p), d + 1);
+            if (m >= 0) { n += m; continue; }        /// * callee flattened
+            if (!x) return -1;
+        }
+        else switch (op) {
+        case inEXIT: case inDOVAR: case inDOES: case inBYE: return -1;
+        case inRFROM: case inRAT: case inTOR: case inRP:
+        case inUNLOOP: case inLEAVE: case inJ: if (!x) return -1;
+        }
+        n += _op_sz(p);
+    }
+    return (x || n <= FORTH_INLINE_SZ) ? n : -1;
+}
+IU _inl_put(IU xt, IU h, int d) {     ///> copy body of xt (inlinable) to h, returns address after it
+    if (_is_const(xt)) return _lit(h, GET(xt + CELLSZ + 3));
+    if (_is_var(xt))   return _lit(h, xt + 2);
+    IU a = xt + (BGET(xt) == inENTER);
+    IU e = _body_end(a, a + FORTH_INLINE_MAX);
+    U8 br = 0;
+    for (IU p = a; p < e; p += _op_sz(p)) if (BRANCH(BGET(p))) br = 1;
+    if (br) {                         /// * verbatim, branches relocated
+        for (IU p = a; p < e; p += _op_sz(p)) {
+            IU sz = _op_sz(p), q = h + p - a;
+            for (IU i=0; i < sz; i++) BSET(q + i, BGET(p + i));
+            if (BRANCH(BGET(p))) SET(q + 1, GET(p + 1) - a + h);
+        }
+        SET(UVAR_LIT, 0);             /// * its end can be a branch target
+        return h + e - a;
+    }
+    for (IU p = a; p < e; p += _op_sz(p)) {
+        U8 op = BGET(p);
+        if (op & fCOLON8) {
+            IU c = _op_xt(p);
+            if (_inline(c, d + 1) >= 0) { h = _inl_put(c, h, d + 1); continue; }
+            for (IU i=0; i < CELLSZ; i++) BSET(h++, BGET(p + i));  /// * kept as a call
+        }
+        else if (op == inBYTE || op == inDOLIT) h = _lit(h, _lit_v(p));
+        else h = _op(h, op);
+    }
+    return h;
+}
+DU _inl(IU xt) {                      ///> append body of xt at HERE (FALSE: not inlinable)
+    if (_inline(xt, 0) < 0) return FALSE;
+    SET(UVAR_CP, _inl_put(xt, GET(UVAR_CP), 0));
+    return TRUE;
+}
+void _inl_flag(IU xt) {               ///> INLINE, shift code of last word up for a leading opENTER
+    IU cp = GET(UVAR_CP);
+    if (xt < FORTH_DIC_ADDR || xt >= cp || BGET(xt) == inENTER) return;
+    if (_is_value(xt) || _is_defer(xt)) return;    /// * TO and IS store at xt+1
+    IU e = _body_end(xt, cp);
+    for (IU p = xt; e && p < e; p += _op_sz(p)) {  /// * a literal within the word could be
+        if (BGET(p) != inDOLIT) continue;          /// * an address or a number, keep it a call
+        IU t = GET(p + 1);
+        if (t >= xt && t <= cp) return;
+    }
+    for (IU p = xt; e && p < e; p += _op_sz(p)) {  /// * branch targets within the word move too
+        if (!BRANCH(BGET(p))) continue;
+        IU t = GET(p + 1);
+        if (t >= xt && t <= cp) SET(p + 1, t + 1);
+    }
+    for (IU p = cp; p > xt; p--) BSET(p, BGET(p - 1));
+    BSET(xt, inENTER);
+    SET(UVAR_CP, cp + 1);
+}
+///
+///> tail calls, ; and EXIT turn a colon call right before them into a jump
+///> unless a branch lands after it (THEN clears 'TAIL) or the callee
+///> reaches into the return stack below its own >R (R> R@ RP, e.g. do$)
+///
+U8 _rs_bound(IU xt, IU cp) {          ///> xt reads or drops the return address it was called with
+    IU e = _body_end(xt, cp);
+    if (!e) e = cp;                   /// * the word being defined, RECURSE
+    int d = 0;                        /// * own >R depth
+    for (IU p = xt; p < e; p += _op_sz(p)) {
+        switch (BGET(p)) {
+        case inTOR:   d++; break;
+        case inRFROM:
+        case inDONEXT: if (--d < 0) return 1; break;
+        case inRAT:   if (!d) return 1; break;
+        case inDODO:  d += 3; break;
+        case inDOLOOP:
+        case inDOPLOOP: if ((d -= 3) < 0) return 1; break;
+        case inUNLOOP:
+        case inLEAVE: if (d < 3) return 1; break; /// * before EXIT, or a jump
+        case inJ:     if (d < 4) return 1; break;
+        case inRP:    return 1;
+        }
+    }
+    return 0;
+}
+void _tail() {                        ///> trailing colon call at 'TAIL into BRAN
+    IU cp = GET(UVAR_CP), t = GET(UVAR_TAIL);
+    SET(UVAR_TAIL, 0);
+    if (!t || t + CELLSZ != cp || !(BGET(t) & fCOLON8)) return;
+    IU xt = _op_xt(t);
+    if (_rs_bound(xt, cp)) return;
+    BSET(t, inBRAN);
+    SET(t + 1, xt);
+    SET(UVAR_CP, cp + 1);
+}
+
+///
+///> MARKER snapshot, [uvars][wordlist heads][ISR vectors, jobs, enables][C API][tasks, quantum]
+///
+#if 23 + ORDER_MAX > FORTH_UVAR_SZ/CELLSZ || FORTH_UVAR_SZ/CELLSZ > 32
+#error "user variables up to 'LIT must fit in FORTH_UVAR_SZ, and in 32 bits of UVAR_KEEP"
+#endif
+#if TASK_MAX > 8
+#error "MARKER keeps live task slots in 8 bits"
+#endif
+#define UVAR_KEEP (0x000f805eUL | (((1UL << ORDER_MAX) - 1) << 20)) /**< uvars restored, with 'ORDER, i.e. not TIB or parser state */
+IU _mark(IU a) {                      ///> snapshot VM state at a, returns size
+    U8 *p = RAM(a);
+    memcpy(p, RAM(FORTH_UVAR_ADDR), FORTH_UVAR_SZ);
+    p += FORTH_UVAR_SZ;
+    for (IU w = GET(FORTH_UVAR_ADDR + CELLSZ*19); w; w = GET(w + CELLSZ)) {
+        memcpy(p, RAM(w), CELLSZ);    /// * heads of VOC-LINK chain
+        p += CELLSZ;
+    }
+    p = intr_snap(p, 0);
+    memcpy(p, _api, sizeof(_api));
+    p += sizeof(_api);
+    U8 live = 0;                      /// * slots of tasks started before the marker
+    for (U8 i=1; i < TASK_MAX; i++) if (_task[i].S) live |= 1 << i;
+    *p++ = live;
+    memcpy(p, &_qmax, sizeof(_qmax));
+    IU n = (IU)(p + sizeof(_qmax) - RAM(a));
+    XINV(a, n);
+    return n;
+}
+void _rollback(IU a) {                ///> restore VM state from snapshot at a
+    U8 *p = RAM(a), *u = RAM(FORTH_UVAR_ADDR);
+    for (int i=0; i < FORTH_UVAR_SZ/CELLSZ; i++, p+=CELLSZ, u+=CELLSZ) {
+        if (UVAR_KEEP & (1UL << i)) memcpy(u, p, CELLSZ);
+    }
+    for (IU w = GET(FORTH_UVAR_ADDR + CELLSZ*19); w; w = GET(w + CELLSZ)) {
+        memcpy(RAM(w), p, CELLSZ);    /// * same chain as snapshot (VOC-LINK restored)
+        p += CELLSZ;
+    }
+    p = intr_snap(p, 1);
+    memcpy(_api, p, sizeof(_api));
+    p += sizeof(_api);
+    U8 live = *p++;                   /// * retire tasks started since, their code is gone
+    for (U8 i=1; i < TASK_MAX; i++) {
+        if (i != _tid && !(live & (1 << i))) _task[i].S = 0;
+    }
+    memcpy(&_qmax, p, sizeof(_qmax));
+}
+
 void _init() {                        ///> VM initializer
     intr_reset();                     /// * reset interrupt handlers
+    memset(_task, 0, sizeof(_task));  /// * main task only
+    _tid = 0; _qmax = _qcnt = 0;
+    _bank = 0;
+    _heap(_ds - FORTH_HEAP_SZ, FORTH_HEAP_SZ);
+
+    _paint(_ds,   _istk);             ///> mark stacks for HWM
+    _paint(_istk, _tib);
 
     T = 0;                            ///> setup control variables
-    S = (DU*)RAM(FORTH_STACK_ADDR - CELLSZ);
-    R = (DU*)RAM(FORTH_STACK_TOP);
+    SP0 = (DU*)RAM(_ds);
+    RP0 = (DU*)RAM(_istk);
+    SPZ = (DU*)RAM(_rs);
+    S   = SP0 - 1;
+    R   = RP0;
 
 #if EXE_TRACE
     tCNT = 0; tTAB = 0;               ///> setup tracing variables
@@ -54,10 +697,27 @@ void _init() {                        ///> VM initializer
     ///   'MODE eval mode (interpreter or compiler)
     ///   'ABORT exception rescue handler (QUIT)
     ///   tmp storage (alternative to return stack)
+    ///   SP0, TIB0, /TIB memory layout (ROM reads these, no literals)
+    ///   NP, 'HDR, 'BOOT name space pointer, header mode, turnkey word
+    ///   CURRENT, VOC-LINK, 'ORDER wordlists, FORTH (i.e. CONTEXT) only
+    ///   'TAIL last colon call compiled
     IU p = FORTH_UVAR_ADDR;           ///> setup Forth user variables
-    SET(p,   FORTH_TIB_ADDR);         /// * set 'TIB pointer
-    SET(p+2, 10);                     /// * set BASE to 10
-    SET(p+4, FORTH_DIC_ADDR);         /// * top of dictionary
+    SET(p,           _tib);           /// * set 'TIB pointer
+    SET(p+CELLSZ,    10);             /// * set BASE to 10
+    SET(p+CELLSZ*2,  FORTH_DIC_ADDR); /// * top of dictionary
+    SET(p+CELLSZ*12, _ds);            /// * SP0 base of data stack
+    SET(p+CELLSZ*13, _tib);           /// * TIB0 base of input buffer
+    SET(p+CELLSZ*14, _roof - _tib);   /// * /TIB size of input buffer
+    SET(p+CELLSZ*15, _ds - FORTH_HEAP_SZ); /// * NP name space below heap
+    SET(p+CELLSZ*16, 0);              /// * 'HDR headers inline
+    SET(p+CELLSZ*17, 0);              /// * 'BOOT no turnkey word
+    SET(p+CELLSZ*18, p+CELLSZ*3);     /// * CURRENT is FORTH
+    SET(p+CELLSZ*19, 0);              /// * VOC-LINK no other wordlist
+    for (int i=0; i < ORDER_MAX; i++) {
+        SET(p+CELLSZ*(20+i), i ? 0 : p+CELLSZ*3);  /// * 'ORDER FORTH only
+    }
+    SET(p+CELLSZ*(20+ORDER_MAX), 0);  /// * 'TAIL no call yet
+    SET(p+CELLSZ*(21+ORDER_MAX), 0);  /// * 'LIT no literal yet
     ///
     /// display init prompt
     ///
@@ -126,7 +786,7 @@ inline void _out(U16 p, U16 v)   ///> Arduino port setting
 /// eForth virtual machine initialization
 ///
 ///> internal (user) variables
-///> *  'TIB    = FORTH_TIB_ADDR (pointer to input buffer)
+///> *  'TIB    = TIB0           (pointer to input buffer)
 ///> *  BASE    = 0x10           (numerical base 0xa for decimal, 0x10 for hex)
 ///> *  CP      = here           (pointer to top of dictionary, first memory location to add new word)
 ///> *  CONTEXT = last           (pointer to name field of the most recently defined word in dictionary)
@@ -134,16 +794,27 @@ inline void _out(U16 p, U16 v)   ///> Arduino port setting
 ///> *  'EVAL   = INTER          ($COMPILE for compiler or $INTERPRET for interpreter)
 ///> *  ABORT   = QUIT           (pointer to error handler, QUIT is the main loop)
 ///> *  tmp     = 0              (scratch pad)
+///> *  SP0, TIB0, /TIB          (memory layout, from ram_sz and tib_sz)
 ///
 using namespace EfVM;
 
-void vm_init(PGM_P rom, U8 *ram, void *io_stream, const char *code) {
+void vm_init(PGM_P rom, U8 *ram, void *io_stream, const char *code,
+             IU ram_sz, IU tib_sz, IU ds_sz, IU rs_sz) {
     io    = (StreamIO*)io_stream;
     _rom  = rom;
     _ram  = ram;
     _pre  = (U8*)code;
 
+    _roof = FORTH_RAM_ADDR + ram_sz;  /// * stacks and TIB on top of RAM
+    _tib  = _roof - tib_sz;           /// * dictionary takes the rest
+    _istk = _tib  - FORTH_ISTK_SZ;
+    _rs   = _istk - rs_sz;
+    _ds   = _rs   - ds_sz;
+
     _init();                    /// * resetting user variables
+#if FORTH_TURNKEY
+    ef_load(_ram);              /// * application from EEPROM, COLD runs 'BOOT
+#endif // FORTH_TURNKEY
 }
 ///
 ///> C interface implementation
@@ -160,6 +831,12 @@ void vm_cfunc(int n, CFP fp) {
     LOG_V(", API", n); LOG_H("=x", (uintptr_t)fp);
 }
 
+void vm_far(void *mem, long sz) {
+    _far    = (U8*)mem;
+    _far_sz = mem ? (U32)sz : 0;
+    LOG_V(", FAR=", (int)(_far_sz >> 16)); LOG(" banks");
+}
+
 void vm_push(int v) {           /// proxy to VM
     PUSH(v);
 }
@@ -169,11 +846,156 @@ int vm_pop() {
     POP();
     return t;
 }
+
+int vm_ilat(int v, int b) {     /// ISR latency statistics
+    return (int)intr_latency(v, b);
+}
+///
+/// fetch next opcode, serving time slice and interrupts first
+/// @return
+///   opcode (colon word call turns into ENTER with ip at its xt)
+///
+__attribute__((always_inline)) inline U8 _fetch(IU &ip, IU &ir) {
+    ///
+    ///> preemptive time slicing (never inside an ISR)
+    ///
+    if (_qmax && !ir && ++_qcnt >= _qmax) ip = _yield(ip);
+    ///
+    ///> serve interrupt routines
+    ///
+    if (!ir) {                          /// * still servcing interrupt
+        ir = intr_service();            /// * get interrupt vectors
+        if (ir) {                       /// * serve interrupt
+            _isr_enter(ip);             /// * switch to ISR stacks
+            RPUSH(ip | IRET_FLAG);      /// * push IRET address
+            ip = ir;                    /// * skip opENTER
+        }
+    }
+    ///
+    ///> fetch primitive opcode or colon word address
+    ///
+#if XLAT_CACHE
+    Xop &x = _xc[ip & (FORTH_MEM_SZ-1)];
+    if (!x.n) _xdecode(ip);             /// * first visit, decode op
+    U8 op = x.op;
+    ip += x.n;                          /// * skip over operand
+    if (op == xcENTER) {                /// * COLON word?
+        RPUSH(ip);                      /// * save return address
+        DEBUG(">>%x", ip);
+        ip = x.arg;
+#else  // !XLAT_CACHE
+    U8 op = BGET(ip++);                 /// * fetch next opcode
+    if (op & fCOLON8) {                 /// * COLON word?
+#if CELLSZ==2
+        RPUSH(ip + 1);                  /// * save return address
+        DEBUG(">>%x", ip + 1);
+        ip = ((U16)(op & 0x7f)<<8)      /// * take high-byte of 16-bit address
+             | BGET(ip);                /// * and low-byte from *IP
+#else  // CELLSZ==4
+        IU xt = op & 0x7f;              /// * call token is high-byte first
+        for (int i=1; i < CELLSZ; i++) xt = (xt << 8) | BGET(ip++);
+        RPUSH(ip);                      /// * save return address
+        DEBUG(">>%x", ip);
+        ip = xt;
+#endif // CELLSZ==2
+        op = 2;                         /// * doLIST a colon word (opENTER)
+#endif // XLAT_CACHE
+#if STACK_GUARD
+        if (STK_BAD()) { ip = _stk_fault(ir); ir = 0; }
+#endif // STACK_GUARD
+        NATIVE(ip);                     /// * run native, ip to resume at
+    }
+    TRACE(op, ip, T, DEPTH());          /// * debug tracing
+    return op;
+}
+///
+/// inline operand of the op, from its decoded slot (ip already past it) or read at ip
+///
+#if XLAT_CACHE
+#define ARG8()   ((U8)_xc[(ip - 2) & (FORTH_MEM_SZ-1)].arg)
+#define ARG()    (_xc[(ip - 1 - CELLSZ) & (FORTH_MEM_SZ-1)].arg)
+#else  // !XLAT_CACHE
+#define ARG8()   BGET(ip++)
+#define ARG()    (ip += CELLSZ, GET(ip - CELLSZ))
+#endif // XLAT_CACHE
+#if AOT
+///
+/// ROM words compiled ahead of time, see _dump_aot in eforth_asm.c
+///   + each primitive is its _X body, inlined (ops bound to ip or ir are left to the interpreter)
+///   + a function returns the ip to go on at, a colon call which returns elsewhere
+///     resumes there in the caller, or leaves for the interpreter
+///
+namespace EfVM {
+#define _X(n, code)  static inline void p_##n() {                \
+    __attribute__((unused)) IU ip = 0, ir = 0;                   \
+    DEBUG("%s",#n); { code; }                                    \
+}
+#include "eforth_vm_ops.h"
+#undef  _X
+#if STACK_GUARD
+#define A_BAD()      STK_BAD()
+#else  // !STACK_GUARD
+#define A_BAD()      0
+#endif // STACK_GUARD
+#define A_EXIT(a)    {                                           \
+    if (I & IRET_FLAG) return a;      /** ISR or task frame */   \
+    IU r = (IU)I; RPOP(); return r;                              \
+}
+#define A_CALL(a, w) {                                           \
+    RPUSH((IU)((a) + CELLSZ));                                   \
+    if (A_BAD()) { RPOP(); return a; } /** interpreter faults */ \
+    ip = w();                                                    \
+    if (ip != (IU)((a) + CELLSZ)) goto resume;                   \
+}
+#define A_EXEC(a)    {                                           \
+    RPUSH((IU)((a) + 1));                                        \
+    ip = (IU)T; POP();                                           \
+    ip = aot_exec(ip);                                           \
+    if (ip != (IU)((a) + 1)) goto resume;                        \
+}
+#define A_LOOP(a, l) {                /** back branch, poll */   \
+    if (_qmax || intr_hits()) return a;                          \
+    goto l;                                                      \
+}
+#include "eforth_aot.h"
+} // namespace EfVM
+#endif // AOT
 ///
 /// eForth virtual machine outer interpreter (single-step) execution unit
 /// @return
 ///   0 - exit
 ///
+#if TAIL_CALL
+/// Note:
+///   tail-call threading
+///      + each opcode handler is a function which fetches and calls the next one
+///      + ip, ir passed as arguments (registers), no shared dispatch branch
+///      + musttail where the compiler has it, otherwise needs -O2 (sibling calls)
+///
+#if defined(__has_attribute) && __has_attribute(musttail)
+  #define MUSTTAIL     __attribute__((musttail))
+#else
+  #define MUSTTAIL
+#endif
+typedef void (*XOP)(IU ip, IU ir);      ///< opcode handler
+extern const XOP _xop[];                ///< handler table, indexed by opcode
+  #define OP(name)     x_##name
+  #define _X(n, code)  static void x_##n(IU ip, IU ir) {  \
+      DEBUG("%s",#n); { code; }                            \
+      U8 op = _fetch(ip, ir);                              \
+      MUSTTAIL return _xop[op](ip, ir);                    \
+  }
+#include "eforth_vm_ops.h"
+
+const XOP _xop[] = { OP(NOP), OPCODES };
+
+void vm_outer() {
+    IU ir = 0;                          ///< interrupt flag
+    IU ip = GET(FORTH_BOOT_ADDR);       ///< ip = cold boot vector
+    U8 op = _fetch(ip, ir);
+    _xop[op](ip, ir);                   ///> returns only on BYE
+}
+#else // !TAIL_CALL
 #if COMPUTED_GOTO
 /// Note:
 ///   computed goto
@@ -185,7 +1007,6 @@ int vm_pop() {
   #define VTABLE       const void *vt[] = { OP(NOP), OPCODES }
   #define DISPATCH(op) goto *vt[op];
   #define _X(n, code)  L_##n: { DEBUG("%s",#n); code; continue; }
-  #define opENTER      2                  /** hardcoded for ENTER */
 #else // !COMPUTED_GOTO
   #define OP(name)     op##name
   #define VTABLE       enum { OP(NOP) = 0, OPCODES }
@@ -198,264 +1019,11 @@ void vm_outer() {
     IU ir = 0;                          ///< interrupt flag
     IU ip = GET(FORTH_BOOT_ADDR);       ///< ip = cold boot vector
     while (1) {                         ///> Forth inner loop
-        ///
-        ///> serve interrupt routines
-        ///
-        if (!ir) {                      /// * still servcing interrupt
-            ir = intr_service();        /// * get interrupt vectors
-            if (ir) {                   /// * serve interrupt
-                RPUSH(ip | IRET_FLAG);  /// * push IRET address
-                ip = ir;                /// * skip opENTER
-            }
-        }
-        ///
-        ///> fetch primitive opcode or colon word address
-        ///
-        U8 op = BGET(ip++);             /// * fetch next opcode
-        if (op & fCOLON8) {             /// * COLON word?
-            RPUSH(ip + 1);              /// * save return address
-            DEBUG(">>%x", ip + 1);
-            ip = ((U16)(op & 0x7f)<<8)  /// * take high-byte of 16-bit address
-                 | BGET(ip);            /// * and low-byte from *IP
-            op = opENTER;               /// * doLIST a colon word
-        }
-        TRACE(op, ip, T, DEPTH());      /// * debug tracing
-        
+        U8 op = _fetch(ip, ir);         /// * next opcode
+
         DISPATCH(op) {
-        ///
-        /// the following part is in assembly for most of Forth implementations
-        ///
-        _X(NOP,   {});
-        _X(EXIT,
-            TAB();
-            ip = I; RPOP();             ///> pop return address
-            if (ip & IRET_FLAG) {       /// * IRETURN?
-                ir = 0;                 /// * interrupt clear
-                ip &= ~IRET_FLAG;
-            });
-        _X(ENTER, {});                  ///> handled above
-        _X(BYE,   _init(); return);     ///> quit, Arduino will restart
-        ///
-        /// @name Console IO
-        /// @{
-        _X(QRX,   _qrx());              ///> fetch char from input console
-        _X(TXSTO, _txsto());            ///> send char to output console
-        /// @}
-        /// @name Built-in ops
-        /// @{
-        _X(BYTE,                        ///> push 8-bit literal
-           PUSH(BGET(ip++)));
-        _X(DOLIT,
-            PUSH(GET(ip));              ///> push literal onto data stack
-            ip += CELLSZ);
-        _X(DOVAR, PUSH(ip+1));          ///> push literal addr to data stack
-                                        /// * +1 means skip EXIT byte (08)
-        /// @}
-        /// @name Branching ops
-        /// @{
-        _X(EXECU,                       ///> ( xt -- ) execute xt
-            DEBUG(">>%x", ip);
-            RPUSH(ip);
-            ip = (IU)T;                 /// * fetch program counter
-            POP());
-        _X(DOES,
-           PUSH(ip+1);                  /// * +1 means skip the offset byte
-           ip += BGET(ip));             /// * skip offset bytes, to does> code
-        _X(DONEXT,
-            TAB();
-            if (I-- > 0) {              ///> check if loop counter > 0
-                ip = GET(ip);           ///>> branch back to FOR
-            }
-            else {                      ///> or,
-                ip += CELLSZ;           ///>> skip to next instruction
-                RPOP();                 ///>> pop off return stack
-            });
-        _X(QBRAN,
-            TAB();
-            if (T) ip += CELLSZ;        ///> next instruction, or
-            else   ip = GET(ip);        ///> fetch branching target address
-            POP());
-        _X(BRAN,                        ///> fetch branching target address
-            TAB();
-            ip = GET(ip));
-        /// @}
-        /// @name Memory Storage ops
-        /// @{
-        _X(STORE,
-            SET(T, *S--);
-            POP());
-        _X(PSTOR,
-            SET(T, (DU)GET(T) + *S--);
-            POP());
-        _X(AT,    T = (DU)GET(T));
-        _X(CSTOR,
-            BSET(T, *S--);
-            POP());
-        _X(CAT,   T = (DU)BGET(T));
-        _X(RFROM, PUSH(I); RPOP());
-        _X(RAT,   PUSH(I));
-        _X(TOR,
-            RPUSH(T);
-            POP());
-        /// @{
-        /// @name Stack ops
-        /// @}
-        _X(DROP,  POP());
-        _X(DUP,   *++S = T);
-        _X(SWAP,
-            DU tmp = T;
-            T      = *S;
-            *S     = tmp);
-        _X(OVER,  DU v = *S; PUSH(v));      /// * note PUSH macro changes S
-        _X(ROT,
-            DU tmp = *(S-1);
-            *(S-1) = *S;
-            *S     = T;
-            T      = tmp);
-        _X(PICK,  T = *(S - T));
-        /// @}
-        /// @name ALU ops
-        /// @{
-        _X(AND,   T &= *S--);
-        _X(OR,    T |= *S--);
-        _X(XOR,   T ^= *S--);
-        _X(INV,   T ^= -1);
-        _X(LSH,   T =  *S-- << T);
-        _X(RSH,   T =  *S-- >> T);
-        _X(ADD,   T += *S--);
-        _X(SUB,   T =  *S-- - T);
-        _X(MUL,   T *= *S--);
-        _X(DIV,   T = T ? *S-- / T : (S--, 0));
-        _X(MOD,   T = T ? *S-- % T : *S--);
-        _X(NEG,   T = -T);
-        /// @}
-        /// @name Logic ops
-        /// @{
-        _X(GT,    T = BOOL(*S-- > T));
-        _X(EQ,    T = BOOL(*S-- ==T));
-        _X(LT,    T = BOOL(*S-- < T));
-        _X(ZGT,   T = BOOL(T > 0));
-        _X(ZEQ,   T = BOOL(T == 0));
-        _X(ZLT,   T = BOOL(T < 0));
-        /// @}
-        /// @name Misc. ops
-        /// @{
-        _X(ONEP,  T++);
-        _X(ONEM,  T--);
-        _X(QDUP,  if (T) *++S = T);
-        _X(DEPTH, DU d = DEPTH(); PUSH(d));
-        _X(RP,
-            DU r = ((U8*)RAM(FORTH_STACK_TOP) - (U8*)R) >> 1;
-            PUSH(r));
-        _X(BL,    PUSH(0x20));
-        _X(CELL,  PUSH(CELLSZ));
-        _X(ABS,   T = abs(T));
-        _X(MAX,   DU s = *S--; if (s > T) T = s);
-        _X(MIN,   DU s = *S--; if (s < T) T = s);
-        _X(WITHIN,                        /// ( u ul uh -- f ) 3rd item is within [ul, uh)
-            DU ul = *S--;
-            DU u  = *S--;
-            T = BOOL((U16)(u - ul) < (U16)(T - ul)));
-        _X(TOUPP, if (T >= 0x61 && T <= 0x7b) T &= 0x5f);
-        _X(COUNT, *++S = T + 1; T = BGET(T));
-        _X(ULESS, T = BOOL((U16)*S-- < (U16)T));
-        _X(UMMOD,                         /// (udl udh u -- ur uq) unsigned divide of a double by single
-            U32 d = (U32)T;               ///> CC: auto variable uses C stack
-            U32 m = ((U32)*S<<16) + (U16)*(S-1);
-            POP();
-            *S   = (DU)(m % d);           ///> remainder
-            T    = (DU)(m / d));          ///> quotient
-        _X(UMSTAR,                        /// (u1 u2 -- ud) unsigned multiply return double product
-            U32 u = (U32)*S * T;
-            DTOP(u));
-        _X(MSTAR,                         /// (n1 n2 -- d) signed multiply, return double product
-            S32 d = (S32)*S * T;
-            DTOP(d));
-        _X(UMPLUS,                        /// ( n1 n2 -- sum c ) return sum of two numbers and carry flag
-            U32 u = (U32)*S + T;
-            DTOP(u));
-        _X(SSMOD,                         /// ( dl dh n -- r q ) double div/mod by a single
-            S32 d = (S32)*S * *(S - 1);
-            *--S  = (DU)(d % T);
-            T     = (DU)(d / T));
-        _X(SMOD,                          /// ( n1 n2 -- r q )
-            DU s = *S;
-            *S = s % T;
-            T  = s / T);
-        _X(MSLAS,
-            S32 d = (S32)*S-- * *S--;     /// ( n1 n2 n3 -- q ) multiply n1 n2, divided by n3 return quotient
-            T = (DU)(d / T));
-        _X(S2D,   S32 d = (S32)T; S++; DTOP(d));
-        _X(D2S,
-            DU s = *S--;
-            T = (T < 0) ? -abs(s) : abs(s));
-        /// @}
-        /// @name Double precision ops
-        /// @{
-        _X(DABS,                          /// ( d -- abs(d) ) absolute value
-            S32 d = S2D(T, *S);
-            DTOP(abs(d)));
-        _X(DNEG,                          /// ( d -- -d ) two's complemente of T double
-            S32 d = S2D(T, *S);
-            DTOP(-d));
-        _X(DADD,                          /// ( d1 d2 -- d1+d2 ) add two double precision numbers
-            S32 d0 = S2D(T, *S);
-            S32 d1 = S2D(*(S-1), *(S-2));
-            S32 d2 = d1 + d0;
-            S -= 2; DTOP(d2));
-        _X(DSUB,                          /// ( d1 d2 -- d1-d2 ) subtract d2 from d1
-            S32 d0 = S2D(T, *S);
-            S32 d1 = S2D(*(S-1), *(S-2));
-            S32 d2 = d1 - d0;
-            S -= 2; DTOP(d2));
-        _X(UDSMOD,                        /// ( d1 d2 -- drem dquo ) 
-            U32 m = ((U32)*(S-1)<<16) + (U16)*(S-2);
-            U32 n = (U32)S2D(T, *S);
-            U32 r = m % n;
-            U32 q = m / n;
-            *(S-2) = r & 0xffff; *(S-1) = r >> 16;
-            DTOP(q));
-        /// TODO: add J
-        _X(SPAT,
-            DU r = (U8*)S - (U8*)RAM(FORTH_STACK_ADDR);
-            PUSH(FORTH_STACK_ADDR + r));
-#if EXE_TRACE
-        _X(TRC,  tCNT = T; POP());
-#else
-        _X(TRC,  POP());
-#endif // EXE_TRACE
-        _X(SAVE,
-            U16 sz = ef_save(_ram);
-            LOG_V(" -> EEPROM ", sz); LOG(" bytes\r\n");
-        );
-        _X(LOAD,
-            U16 sz = ef_load(_ram);
-            LOG_V(" <- EEPROM ", sz); LOG(" bytes\r\n");
-        );
-        _X(CALL,
-            _ccall());                     /// * call C function
-        _X(CLK,
-            U32 t = millis();
-            *++S  = T; S++;                /// * allocate 2-cells for clock ticks
-            DTOP(t));
-        /// @}
-        /// @name Arduino specific ops
-        /// @{
-        _X(PIN,
-            pinMode(T, *S-- ? OUTPUT : INPUT);
-            POP());
-        _X(MAP,
-            U16 tmp = map(T, *(S-3), *(S-2), *(S-1), *S);
-            S -= 4;
-            T = tmp);
-        _X(IN,    T = digitalRead(T));
-        _X(OUT,   _out(T, *S);   S--; POP());
-        _X(AIN,   T = analogRead(T));
-        _X(PWM,   analogWrite(T, *S);    S--; POP());
-        _X(TMISR, intr_add_tmisr(T, *S, *(S-1)); S-=2; POP());
-        _X(PCISR, intr_add_pcisr(T, *S); S--; POP());
-        _X(TMRE,  intr_timer_enable(T);   POP());
-        _X(PCIE,  intr_pci_enable(T);     POP());
+#include "eforth_vm_ops.h"
         }
     }
 }
+#endif // TAIL_CALL
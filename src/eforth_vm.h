@@ -6,13 +6,16 @@
  *
  * @code
  *     0x0000-0x1fff ROM (8K Flash memory)
- *     0x2000-0x24ff RAM (2K dynamic memory)
- *         0x2000-0x201f User Variables
- *         0x2020-0x23ff User Dictionary
+ *     0x2000-0x251f RAM (2K dynamic memory)
+ *         0x2000-0x203f User Variables (32 cells)
+ *         0x2040-0x23ff User Dictionary
  *         0x2400-0x247f Data/Return Stacks
- *         0x2480-0x24ff TIB (Terminal Input Buffer)
- *         0x2500        heap
+ *         0x2480-0x249f ISR Data/Return Stacks
+ *         0x24a0-0x251f TIB (Terminal Input Buffer)
+ *         0x2520        heap
  * @endcode
+ * With CELLSZ=4 (host), the same map is stretched to a 64K dictionary
+ * (see eforth_config.h) in a flat 128K address space.
  *
  * ### Data and Return Stack
  *
@@ -22,6 +25,10 @@
  *    T -> [S0, S1, S2,..., R1, R0] <- I
  * @endcode
  * Note: Dr. Ting uses U8 (0~255) for wrap-around control
+ *
+ * Interrupt service routines run on their own (smaller) stack pair,
+ * so an ISR never eats into the foreground stacks. Both pairs are
+ * painted with STK_MARK at init, HWM scans for the untouched cells.
  */
 #ifndef __EFORTH_VM_H
 #define __EFORTH_VM_H
@@ -32,13 +39,75 @@ namespace EfVM {
 ///@{
 extern PGM_P    _rom;             ///< ROM, Forth word stored in Arduino Flash Memory
 extern U8       *_ram;            ///< RAM, memory block for user define dictionary
+extern DU       *SP0;             ///< base of current data stack (tracing)
 extern StreamIO *io;              ///< Stream or UART IO interface
 ///@}
 #define RAM_FLAG       0xe000     /**< RAM ranger      (0x2000~0x7fff) */
 #define IDX_MASK       0x07ff     /**< RAM index mask  (0x0000~0x07ff) */
-#define IRET_FLAG      0x8000     /**< interrupt return flag           */
+#define IRET_FLAG      fCOLON     /**< interrupt return flag (top bit) */
+#define STK_MARK       ((DU)0xa5a5a5a5) /**< stack paint for high-water mark */
 #define BOOL(f)        ((f) ? TRUE : FALSE)
 #define RAM(i)         &_ram[(i) - FORTH_RAM_ADDR]
+#if MEM_FLAT
+///
+/// flat memory model, ROM image copied in front of RAM (_ram == _rom + FORTH_RAM_ADDR)
+/// no range check, so RAM can be sized at vm_init up to FORTH_RAM_MAX
+///
+#define MEM(d)         ((U8*)_rom + ((IU)(d) & (FORTH_MEM_SZ-1)))
+U8 BGET(IU d) {
+    return *MEM(d);
+}
+#if XLAT_CACHE || JIT_X64
+///
+/// every store drops the decoded ops or native code it overlaps (see _xinv)
+///
+void _xinv(IU d, IU n);
+#define XINV(d, n)     _xinv(d, n)
+#else  // !(XLAT_CACHE || JIT_X64)
+#define XINV(d, n)     ((void)0)
+#endif // XLAT_CACHE || JIT_X64
+#define BSET(d, c)     (XINV(d, 1), *MEM(d)=(U8)(c))
+#if MEM_NATIVE
+///
+/// cells are kept in native byte order, one (unaligned) load/store per access
+///
+IU GET(IU d) {
+    IU v; memcpy(&v, MEM(d), sizeof(IU)); return v;
+}
+void SET(IU d, IU v) {
+    XINV(d, CELLSZ);
+    memcpy(MEM(d), &v, sizeof(IU));
+}
+#else // !MEM_NATIVE
+///
+/// big-endian cells, same ROM image as the MCU
+///
+IU GET(IU d) {
+    U8 *p = MEM(d);
+    return ((IU)p[0]<<8) | p[1];
+}
+void SET(IU d, IU v) {
+    XINV(d, CELLSZ);
+    U8 *p = MEM(d);
+    p[0] = (U8)(v>>8);
+    p[1] = (U8)v;
+}
+#endif // MEM_NATIVE
+#elif MEM_NATIVE
+///
+/// native-endian cells, a word fetch from Flash is a single pgm_read_word
+///
+U8 BGET(U16 d) {
+    return (U8)((d&RAM_FLAG) ? _ram[d&IDX_MASK] : pgm_read_byte(_rom+d));
+}
+U16 GET(U16 d) {
+    return (d&RAM_FLAG) ? *(U16*)&_ram[d&IDX_MASK] : pgm_read_word(_rom+d);
+}
+#define BSET(d, c)     (_ram[(d)&IDX_MASK]=(U8)(c))
+void SET(U16 d, U16 v) {
+    *(U16*)&_ram[d&IDX_MASK] = v;
+}
+#else // !MEM_NATIVE
 ///
 /// byte (8-bit) fetch from either RAM or ROM depends on filtered range
 ///
@@ -58,16 +127,19 @@ void SET(U16 d, U16 v) {
 	BSET(d,   v>>8);
 	BSET(d+1, v&0xff);
 }
-#define S2D(h, l) (((S32)(h)<<16) | ((l)&0xffff))
+#endif // MEM_NATIVE
+#define S2D(h, l) (((DU2)(h)<<CELL_BITS) | (UDU)(l))
 ///
 /// push a value onto stack top
 ///
-#define DEPTH()  ((DU)((U8*)S - RAM(FORTH_STACK_ADDR)) >> 1)
+#define DEPTH()  ((DU)(S - SP0))
 #define PUSH(v)  { *++S = T; T = (v); }
 #define RPUSH(v) { *--R = I; I = (v); }
 #define POP()    (T = *S--)
 #define RPOP()   (I = *R++)
-#define DTOP(d)  { *S = (d)&0xffff; T = (d)>>16; }
+#define DTOP(d)  { *S = (DU)(d); T = (DU)((DU2)(d)>>CELL_BITS); }
+#define STK_BAD() (S < SP0 - 1 || S + 1 >= R || \
+                   (SPZ && (S + 1 >= SPZ || R < SPZ)))   /**< under/overflow */
 
 ///
 ///@name Tracing
@@ -90,7 +162,15 @@ int constexpr opEXEC  = 9;
     LOG("\n");                            \
     for (int i=0; i<tTAB; i++) LOG("  "); \
 }
-void TRACE(U8 op, U16 ip, U16 top, S16 s)
+IU _nfa(IU xt)                               ///> name field of xt (0: headerless)
+{
+    for (IU n = GET(FORTH_UVAR_ADDR + CELLSZ*3); n; n = GET(n - CELLSZ)) {
+        IU a = n + 1 + (BGET(n) & 0x1f);
+        if (((BGET(n) & fHDR) ? (IU)GET(a) : a) == xt) return n;
+    }
+    return 0;
+}
+void TRACE(U8 op, IU ip, DU top, DU s)
 {
     if (!tCNT) return;                       /// * skip if not tracing or end of program
     // indent call depth
@@ -99,12 +179,12 @@ void TRACE(U8 op, U16 ip, U16 top, S16 s)
     	tTAB++;
     }
     // display IP:W[opcode]
-    U16 w = ip - 1;
+    IU w = ip - 1;
     LOG_H(" ", w);                           /// * mem pointer
 	LOG_H("[", op); LOG("]");                /// * opcode to be executed
     // dump stack
     for (int i=0; i<s; i++) {
-        LOG_H("_", *((DU*)RAM(FORTH_STACK_ADDR) + (i+1)));
+        LOG_H("_", *(SP0 + (i+1)));
     }
     LOG_H("_", top);
     LOG("_");
@@ -113,10 +193,10 @@ void TRACE(U8 op, U16 ip, U16 top, S16 s)
     case opBYTE:  LOG_H("$", BGET(ip)); LOG(" "); break;
     case opDOLIT: LOG_H("$", GET(ip));  LOG(" "); break;
     case opEXIT:  LOG(";");  --tTAB;              break;
-    case opEXEC: w = top; /** no break */
+    case opEXEC: ip = top; /** no break */
     case opENTER:                                 /// * display word name
-    	for (--w; (BGET(w) & 0x7f)>0x20; w--);    /// * retract pointer to word name (ASCII range: 0x21~0x7f)
-    	int len = BGET(w++) & 0x1f;               /// Forth allows 31 char max
+    	w = _nfa(ip);                             /// * look up name in dictionary
+    	int len = w ? BGET(w++) & 0x1f : 0;       /// Forth allows 31 char max
     	for (int i=0; i<len; i++, w++) {
     		LOG_C((char)BGET(w));
     	}
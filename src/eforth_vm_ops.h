@@ -0,0 +1,341 @@
+/**
+ * @file
+ * @brief eForth VM opcode handlers
+ *
+ * Note: not a standalone header, included by vm_outer in eforth_vm.cpp
+ *       once per dispatcher, _X(name, code) decides what a handler becomes
+ *       (switch case, computed goto label, or tail-calling function)
+ */
+///
+/// the following part is in assembly for most of Forth implementations
+///
+_X(NOP,   {});
+_X(EXIT,
+    TAB();
+    ip = I; RPOP();             ///> pop return address
+    if (ip & IRET_FLAG) {       /// * IRETURN?
+        ip &= ~IRET_FLAG;
+        if (ip) {
+            ir = 0;             /// * interrupt clear
+            _isr_leave();       /// * back to foreground stacks
+        }
+        else ip = _task_end();  /// * task xt returned
+    });
+_X(ENTER, {});                  ///> handled by _fetch
+_X(BYE,   _init(); return);     ///> quit, Arduino will restart
+///
+/// @name Console IO
+/// @{
+_X(QRX,   _qrx());              ///> fetch char from input console
+_X(TXSTO, _txsto());            ///> send char to output console
+/// @}
+/// @name Built-in ops
+/// @{
+_X(BYTE,                        ///> push 8-bit literal
+   PUSH(ARG8()));
+_X(DOLIT,
+    PUSH(ARG()));               ///> push literal onto data stack
+_X(DOVAR, PUSH(ip+1));          ///> push literal addr to data stack
+                                /// * +1 means skip EXIT byte (08)
+/// @}
+/// @name Branching ops
+/// @{
+_X(EXECU,                       ///> ( xt -- ) execute xt
+    DEBUG(">>%x", ip);
+    RPUSH(ip);
+    ip = (IU)T;                 /// * fetch program counter
+    POP();
+    NATIVE(ip));                /// * native, if xt compiled
+_X(DOES,
+   PUSH(ip+1);                  /// * +1 means skip the offset byte
+   ip += BGET(ip));             /// * skip offset bytes, to does> code
+_X(DODO,                        ///> ( limit index -- ) loop frame, I index, limit and exit below
+    IU a = ARG();               ///> leave target, past LOOP
+    RPUSH(a);
+    RPUSH(*S--);
+    RPUSH(T);
+    POP());
+_X(DOLOOP,
+    TAB();
+    IU a = ARG();               ///> loop body
+    if (++I != *R) ip = a;      ///>> index not at limit, branch back to DO
+    else { R += 2; RPOP(); });  ///>> or, drop loop frame
+_X(DOPLOOP,                     ///> ( n -- ) back until I crosses limit-1|limit
+    TAB();
+    IU a = ARG();
+    DU d = (DU)(I - *R);        ///> index to limit, before and after
+    DU e = (DU)(d + T);
+    I += T;
+    if (((d ^ e) & (d ^ T)) >= 0) ip = a;
+    else { R += 2; RPOP(); }
+    POP());
+_X(UNLOOP, R += 2; RPOP());     ///> drop loop frame
+_X(LEAVE,                       ///> drop loop frame, continue past LOOP
+    ip = (IU)R[1];
+    R += 2; RPOP());
+_X(J,     PUSH(R[2]));          ///> index of outer DO loop
+_X(DONEXT,
+    TAB();
+    IU a = ARG();               ///> branch target
+    if (I-- > 0) ip = a;        ///>> loop counter > 0, branch back to FOR
+    else         RPOP());       ///>> or, pop off return stack
+_X(QBRAN,
+    TAB();
+    IU a = ARG();               ///> branching target address
+    if (!T) ip = a;             ///> taken on zero, or next instruction
+    POP());
+_X(BRAN,                        ///> fetch branching target address
+    TAB();
+    ip = ARG());
+/// @}
+/// @name Memory Storage ops
+/// @{
+_X(STORE,
+    SET(T, *S--);
+    POP());
+_X(PSTOR,
+    SET(T, (DU)GET(T) + *S--);
+    POP());
+_X(AT,    T = (DU)GET(T));
+_X(CSTOR,
+    BSET(T, *S--);
+    POP());
+_X(CAT,   T = (DU)BGET(T));
+_X(RFROM, PUSH(I); RPOP());
+_X(RAT,   PUSH(I));
+_X(TOR,
+    RPUSH(T);
+    POP());
+/// @{
+/// @name Stack ops
+/// @}
+_X(DROP,  POP());
+_X(DUP,   *++S = T);
+_X(SWAP,
+    DU tmp = T;
+    T      = *S;
+    *S     = tmp);
+_X(OVER,  DU v = *S; PUSH(v));      /// * note PUSH macro changes S
+_X(ROT,
+    DU tmp = *(S-1);
+    *(S-1) = *S;
+    *S     = T;
+    T      = tmp);
+_X(PICK,  T = *(S - T));
+/// @}
+/// @name ALU ops
+/// @{
+_X(AND,   T &= *S--);
+_X(OR,    T |= *S--);
+_X(XOR,   T ^= *S--);
+_X(INV,   T ^= -1);
+_X(LSH,   T =  *S-- << T);
+_X(RSH,   T =  *S-- >> T);
+_X(ADD,   T += *S--);
+_X(SUB,   T =  *S-- - T);
+_X(MUL,   T *= *S--);
+_X(DIV,   T = T ? *S-- / T : (S--, 0));
+_X(MOD,   T = T ? *S-- % T : *S--);
+_X(NEG,   T = -T);
+/// @}
+/// @name Logic ops
+/// @{
+_X(GT,    T = BOOL(*S-- > T));
+_X(EQ,    T = BOOL(*S-- ==T));
+_X(LT,    T = BOOL(*S-- < T));
+_X(ZGT,   T = BOOL(T > 0));
+_X(ZEQ,   T = BOOL(T == 0));
+_X(ZLT,   T = BOOL(T < 0));
+/// @}
+/// @name Misc. ops
+/// @{
+_X(ONEP,  T++);
+_X(ONEM,  T--);
+_X(QDUP,  if (T) *++S = T);
+_X(DEPTH, DU d = DEPTH(); PUSH(d));
+_X(RP,
+    DU r = (DU)(RP0 - R);
+    PUSH(r));
+_X(BL,    PUSH(0x20));
+_X(CELL,  PUSH(CELLSZ));
+_X(ABS,   T = abs(T));
+_X(MAX,   DU s = *S--; if (s > T) T = s);
+_X(MIN,   DU s = *S--; if (s < T) T = s);
+_X(WITHIN,                        /// ( u ul uh -- f ) 3rd item is within [ul, uh)
+    DU ul = *S--;
+    DU u  = *S--;
+    T = BOOL((UDU)(u - ul) < (UDU)(T - ul)));
+_X(TOUPP, if (T >= 0x61 && T <= 0x7b) T &= 0x5f);
+_X(COUNT, *++S = T + 1; T = BGET(T));
+_X(ULESS, T = BOOL((UDU)*S-- < (UDU)T));
+_X(UMMOD,                         /// (udl udh u -- ur uq) unsigned divide of a double by single
+    UDU2 d = (UDU2)T;             ///> CC: auto variable uses C stack
+    UDU2 m = ((UDU2)*S<<CELL_BITS) + (UDU)*(S-1);
+    POP();
+    *S   = (DU)(m % d);           ///> remainder
+    T    = (DU)(m / d));          ///> quotient
+_X(UMSTAR,                        /// (u1 u2 -- ud) unsigned multiply return double product
+    UDU2 u = (UDU2)*S * T;
+    DTOP(u));
+_X(MSTAR,                         /// (n1 n2 -- d) signed multiply, return double product
+    DU2 d = (DU2)*S * T;
+    DTOP(d));
+_X(UMPLUS,                        /// ( n1 n2 -- sum c ) return sum of two numbers and carry flag
+    UDU2 u = (UDU2)*S + T;
+    DTOP(u));
+_X(SSMOD,                         /// ( dl dh n -- r q ) double div/mod by a single
+    DU2 d = (DU2)*S * *(S - 1);
+    *--S  = (DU)(d % T);
+    T     = (DU)(d / T));
+_X(SMOD,                          /// ( n1 n2 -- r q )
+    DU s = *S;
+    *S = s % T;
+    T  = s / T);
+_X(MSLAS,
+    DU2 d = (DU2)*S-- * *S--;     /// ( n1 n2 n3 -- q ) multiply n1 n2, divided by n3 return quotient
+    T = (DU)(d / T));
+_X(S2D,   DU2 d = (DU2)T; S++; DTOP(d));
+_X(D2S,
+    DU s = *S--;
+    T = (T < 0) ? -abs(s) : abs(s));
+/// @}
+/// @name Double precision ops
+/// @{
+_X(DABS,                          /// ( d -- abs(d) ) absolute value
+    DU2 d = S2D(T, *S);
+    DTOP(abs(d)));
+_X(DNEG,                          /// ( d -- -d ) two's complemente of T double
+    DU2 d = S2D(T, *S);
+    DTOP(-d));
+_X(DADD,                          /// ( d1 d2 -- d1+d2 ) add two double precision numbers
+    DU2 d0 = S2D(T, *S);
+    DU2 d1 = S2D(*(S-1), *(S-2));
+    DU2 d2 = d1 + d0;
+    S -= 2; DTOP(d2));
+_X(DSUB,                          /// ( d1 d2 -- d1-d2 ) subtract d2 from d1
+    DU2 d0 = S2D(T, *S);
+    DU2 d1 = S2D(*(S-1), *(S-2));
+    DU2 d2 = d1 - d0;
+    S -= 2; DTOP(d2));
+_X(UDSMOD,                        /// ( d1 d2 -- drem dquo ) 
+    UDU2 m = ((UDU2)*(S-1)<<CELL_BITS) + (UDU)*(S-2);
+    UDU2 n = (UDU2)S2D(T, *S);
+    UDU2 r = m % n;
+    UDU2 q = m / n;
+    *(S-2) = (DU)r; *(S-1) = (DU)(r >> CELL_BITS);
+    DTOP(q));
+_X(SPAT,
+    DU r = (U8*)S - _ram;
+    PUSH(FORTH_RAM_ADDR + r));
+#if EXE_TRACE
+_X(TRC,  tCNT = T; POP());
+#else
+_X(TRC,  POP());
+#endif // EXE_TRACE
+_X(SAVE,
+    _prune();                      /// * name space is not saved
+    IU sz = ef_save(_ram);
+    LOG_V(" -> EEPROM ", sz); LOG(" bytes\r\n");
+);
+_X(LOAD,
+    IU sz = ef_load(_ram);
+    XFLUSH();                      /// * dictionary replaced
+    LOG_V(" <- EEPROM ", sz); LOG(" bytes\r\n");
+);
+_X(CALL,
+    _ccall());                     /// * call C function
+_X(CLK,
+    U32 t = millis();
+    *++S  = T; S++;                /// * allocate 2-cells for clock ticks
+    DTOP(t));
+/// @}
+/// @name Arduino specific ops
+/// @{
+_X(PIN,
+    pinMode(T, *S-- ? OUTPUT : INPUT);
+    POP());
+_X(MAP,
+    DU tmp = map(T, *(S-3), *(S-2), *(S-1), *S);
+    S -= 4;
+    T = tmp);
+_X(IN,    T = digitalRead(T));
+_X(OUT,   _out(T, *S);   S--; POP());
+_X(AIN,   T = analogRead(T));
+_X(PWM,   analogWrite(T, *S);    S--; POP());
+_X(TMISR, intr_add_tmisr(T, *S, *(S-1)); S-=2; POP());
+_X(PCISR, intr_add_pcisr(T, *S); S--; POP());
+_X(TMRE,  intr_timer_enable(T);   POP());
+_X(PCIE,  intr_pci_enable(T);     POP());
+_X(SCHED,                       /// ( xt dl dh n -- ) run xt at d, then every n ms
+    U32 d = (U32)S2D(*S, *(S-1));
+    intr_add_job(*(S-2), d, T);
+    S -= 3; POP());
+_X(UNSCHED, intr_del_job(T); POP());
+_X(ILAT,  T = intr_latency(T, *S); S--);
+_X(ILAT0, intr_latency_reset());
+_X(HWM,   T = _hwm((U8)T & 3));
+_X(TASK,                        /// ( xt a n -- t ) create task
+    T = _task_add(*(S-1), *S, T);
+    S -= 2);
+_X(QUANT, _qmax = T; _qcnt = 0; POP());
+_X(CPU,
+    U32 n = _task_ops((U8)T);
+    S++; DTOP(n));
+/// @}
+/// @name Far memory ops (banked, out of range reads 0, writes dropped)
+/// @{
+_X(BANK,  _bank = (U16)T; POP());
+_X(FAT,
+    U8 *p = _fptr(T, CELLSZ);
+    DU v = 0;
+    if (p) memcpy(&v, p, CELLSZ);
+    T = v);
+_X(FSTOR,
+    U8 *p = _fptr(T, CELLSZ);
+    if (p) memcpy(p, S, CELLSZ);
+    S--; POP());
+_X(FCAT,
+    U8 *p = _fptr(T, 1);
+    T = p ? (DU)*p : 0);
+_X(FCSTO,
+    U8 *p = _fptr(T, 1);
+    if (p) *p = (U8)*S;
+    S--; POP());
+_X(TOFAR,                       /// ( a fa n -- ) RAM to far memory
+    U8 *p = _fptr(*S, T);
+    IU a  = *(S-1);
+    if (p) for (IU i=0; i < (IU)T; i++) p[i] = BGET(a + i);
+    S -= 2; POP());
+_X(FARFR,                       /// ( fa a n -- ) far memory to RAM
+    U8 *p = _fptr(*(S-1), T);
+    IU a  = *S;
+    if (p) for (IU i=0; i < (IU)T; i++) BSET(a + i, p[i]);
+    S -= 2; POP());
+/// @}
+/// @name Heap ops (pool and arena)
+/// @{
+_X(HEAP,  _heap(*S, T); S--; POP());
+_X(ALLOC,                       /// ( u -- a ior )
+    IU a = _alloc(T);
+    T = a;
+    PUSH(a ? 0 : -1));
+_X(FREE,  T = _free(T));        /// ( a -- ior )
+_X(RESIZ,                       /// ( a u -- a' ior )
+    IU a = _resize(*S, T);
+    if (a) *S = a;
+    T = a ? 0 : -1);
+_X(AMARK, PUSH(_abot));
+_X(AREL,
+    IU m = (IU)T;
+    if (m >= _hp0 && m <= _abot) _abot = m;
+    POP());
+/// @}
+_X(QSTK,  if (STK_BAD()) { ip = _stk_fault(ir); ir = 0; });
+_X(PRUNE, _prune());
+_X(SNAP,  T = _mark(T));        /// ( a -- n )
+_X(RESTO, _rollback(T); POP()); /// ( a -- )
+_X(INL,   T = _inl(T));         /// ( xt -- f )
+_X(INLF,  _inl_flag(T); POP()); /// ( xt -- )
+_X(TAIL,  _tail());
+_X(LITC,  _litc(T); POP());    /// ( n -- )
+_X(OPC,   _opc((U8)T); POP()); /// ( op -- )